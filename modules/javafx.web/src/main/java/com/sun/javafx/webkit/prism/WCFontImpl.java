@@ -111,8 +111,14 @@ final class WCFontImpl extends WCFont {
         return strike;
     }
 
-    @Override public double getGlyphWidth(int glyph) {
-        return getFontStrike().getFontResource().getAdvance(glyph, font.getSize());
+    @Override public float[] getGlyphWidths(int firstGlyph, int count) {
+        FontResource fontResource = getFontStrike().getFontResource();
+        float size = font.getSize();
+        float[] widths = new float[count];
+        for (int i = 0; i < count; i++) {
+            widths[i] = fontResource.getAdvance(firstGlyph + i, size);
+        }
+        return widths;
     }
 
     @Override public float[] getGlyphBoundingBox(int glyph) {
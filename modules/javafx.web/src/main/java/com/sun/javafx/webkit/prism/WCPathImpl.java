@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.javafx.webkit.prism;
 
 import com.sun.javafx.geom.Arc2D;
 import com.sun.javafx.geom.Ellipse2D;
+import com.sun.javafx.geom.IllegalPathStateException;
 import com.sun.javafx.geom.Path2D;
 import com.sun.javafx.geom.PathIterator;
 import com.sun.javafx.geom.Point2D;
@@ -162,7 +163,7 @@ final class WCPathImpl extends WCPath<Path2D> {
                     new Object[] {getID(), rule, x, y});
         }
         final int savedRule = path.getWindingRule();
-        path.setWindingRule(rule);
+        setWindingRule(rule);
         final boolean res = path.contains((float)x, (float)y);
         path.setWindingRule(savedRule);
 
@@ -230,6 +231,58 @@ final class WCPathImpl extends WCPath<Path2D> {
         path.append(((WCPathImpl)p).path, false);
     }
 
+    public void addSegments(int[] types, float[] coords) {
+        if (log.isLoggable(Level.FINE)) {
+            log.fine("WCPathImpl({0}).addSegments({1})",
+                    new Object[] {getID(), types.length});
+        }
+        int ci = 0;
+        for (int type : types) {
+            try {
+                switch (type) {
+                    case WCPathIterator.SEG_MOVETO:
+                        hasCP = true;
+                        path.moveTo(coords[ci], coords[ci + 1]);
+                        break;
+                    case WCPathIterator.SEG_LINETO:
+                        hasCP = true;
+                        path.lineTo(coords[ci], coords[ci + 1]);
+                        break;
+                    case WCPathIterator.SEG_QUADTO:
+                        hasCP = true;
+                        path.quadTo(coords[ci], coords[ci + 1],
+                                    coords[ci + 2], coords[ci + 3]);
+                        break;
+                    case WCPathIterator.SEG_CUBICTO:
+                        hasCP = true;
+                        path.curveTo(coords[ci], coords[ci + 1],
+                                     coords[ci + 2], coords[ci + 3],
+                                     coords[ci + 4], coords[ci + 5]);
+                        break;
+                    case WCPathIterator.SEG_CLOSE:
+                        path.closePath();
+                        break;
+                }
+            } catch (IllegalPathStateException e) {
+                // Skip the segment as a separate call would do
+                log.fine("WCPathImpl({0}).addSegments(): {1}",
+                        new Object[] {getID(), e.getMessage()});
+            }
+            switch (type) {
+                case WCPathIterator.SEG_MOVETO:
+                case WCPathIterator.SEG_LINETO:
+                    ci += 2;
+                    break;
+                case WCPathIterator.SEG_QUADTO:
+                    ci += 4;
+                    break;
+                case WCPathIterator.SEG_CUBICTO:
+                    ci += 6;
+                    break;
+            }
+        }
+    }
+
     public void closeSubpath() {
         if (log.isLoggable(Level.FINE)) {
             log.fine("WCPathImpl({0}).closeSubpath()", getID());
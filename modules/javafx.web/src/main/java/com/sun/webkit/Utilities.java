@@ -27,6 +27,7 @@ package com.sun.webkit;
 
 import java.lang.reflect.InvocationTargetException;
 import java.lang.reflect.Method;
+import java.lang.reflect.Modifier;
 import java.security.AccessControlContext;
 import java.security.AccessController;
 import java.security.PrivilegedActionException;
@@ -68,4 +69,35 @@ public abstract class Utilities {
             throw cause;
         }
     }
+
+    /*
+     * Returns whether the JavaScript bridge may call the given method with
+     * a plain JNI call instead of fwkInvokeWithContext. Only public methods
+     * of public, exported application classes qualify: JDK and JavaFX
+     * classes may have caller sensitive methods, which must be called
+     * through the reflection trampoline. JavaFX is recognized by package
+     * as well as by module, since it may also run from the class path.
+     */
+    private static boolean fwkCanInvokeDirectly(Method method) {
+        final Class<?> clazz = method.getDeclaringClass();
+        if (!Modifier.isPublic(clazz.getModifiers())
+                || !Modifier.isPublic(method.getModifiers())
+                || !clazz.getModule().isExported(clazz.getPackageName())) {
+            return false;
+        }
+        final ClassLoader loader = clazz.getClassLoader();
+        if (loader == null || loader == ClassLoader.getPlatformClassLoader()) {
+            return false;
+        }
+        final String moduleName = clazz.getModule().getName();
+        if (moduleName != null && moduleName.startsWith("javafx.")) {
+            return false;
+        }
+        final String packageName = clazz.getPackageName();
+        return !packageName.startsWith("javafx.")
+                && !packageName.startsWith("com.sun.javafx.")
+                && !packageName.startsWith("com.sun.webkit.")
+                && !packageName.equals("javafx")
+                && !packageName.equals("com.sun.webkit");
+    }
 }
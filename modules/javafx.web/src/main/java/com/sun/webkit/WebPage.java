@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -82,6 +82,7 @@ public final class WebPage {
     private final static PlatformLogger paintLog = PlatformLogger.getLogger(WebPage.class.getName() + ".paint");
 
     private static final int MAX_FRAME_QUEUE_SIZE = 10;
+    private static final int MAX_DIRTY_RECTS = 16;
 
     // Native WebPage* pointer
     private long pPage = 0;
@@ -128,6 +129,21 @@ public final class WebPage {
     // An ID of the current updateContent cycle associated with an updateContent call.
     private int updateContentCycleID;
 
+    // Whether the render queues painted for the page tiles are retained and
+    // replayed until the content of the tiles is invalidated.
+    private static final boolean useRetainedDisplayList =
+            AccessController.doPrivileged((PrivilegedAction<Boolean>) () ->
+                    Boolean.valueOf(System.getProperty(
+                            "com.sun.webkit.retainedDisplayList", "false")));
+
+    private static final int TILE_SIZE = 256;
+
+    // The render queues recorded for the page tiles, keyed by tile row and
+    // column. Null unless useRetainedDisplayList is set.
+    // Accessed on: Event thread only.
+    private final Map<Long, WCRenderQueue> retainedTiles =
+            useRetainedDisplayList ? new HashMap<Long, WCRenderQueue>() : null;
+
     static {
         AccessController.doPrivileged((PrivilegedAction<Void>) () -> {
             NativeLibLoader.loadLibrary("jfxwebkit");
@@ -146,14 +162,45 @@ public final class WebPage {
                     "com.sun.webkit.useJIT", "true"));
             final boolean useDFGJIT = Boolean.valueOf(System.getProperty(
                     "com.sun.webkit.useDFGJIT", "true"));
+            // The FTL tier is only built on x86-64 Linux, and is opt-in there.
+            final boolean useFTLJIT = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.useFTLJIT", "false"));
 
             // TODO: Enable CSS3D by default once it is stabilized.
             boolean useCSS3D = Boolean.valueOf(System.getProperty(
                     "com.sun.webkit.useCSS3D", "false"));
             useCSS3D = useCSS3D && Platform.isSupported(ConditionalFeature.SCENE3D);
 
+            // Decode GIF and BMP images natively instead of going through
+            // WCImageDecoder upcalls.
+            final boolean useNativeImageDecoders = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.useNativeImageDecoders", "false"));
+
+            // The time in milliseconds the HTML parser may run before
+            // yielding back to the event thread.
+            final int parserTimeLimit = Integer.getInteger(
+                    "com.sun.webkit.parserTimeLimit", 50);
+
+            // requestAnimationFrame callbacks are paced to the pulse rate
+            // so that animations do not outrun the frames FX can present.
+            final int pulseRate = Integer.getInteger(
+                    "javafx.animation.pulse", 60);
+
+            // Size, in megabytes, the JavaScript heap shared by all pages
+            // should stay within. 0 sizes it against the physical memory.
+            // Worker heaps are sized against it too, each on its own.
+            final int jsHeapBudget = Integer.getInteger(
+                    "com.sun.webkit.jsHeapBudget", 0);
+
             // Initialize WTF, WebCore and JavaScriptCore.
-            twkInitWebCore(useJIT, useDFGJIT, useCSS3D);
+            twkInitWebCore(useJIT, useDFGJIT, useFTLJIT, useCSS3D,
+                           useNativeImageDecoders, parserTimeLimit, pulseRate,
+                           jsHeapBudget);
+
+            // Whether direct NIO buffers reach JavaScript as typed arrays
+            // sharing their memory rather than as Java objects.
+            twkSetShareDirectBuffers(Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.shareDirectBuffers", "false")));
             return null;
         });
 
@@ -161,13 +208,41 @@ public final class WebPage {
 
     private static boolean firstWebPageCreated = false;
 
+    // A critical memory release drops the caches and the compiled code of
+    // all pages, so it happens at most once per interval.
+    private static final long CRITICAL_RELEASE_INTERVAL_NANOS = 60_000_000_000L;
+
+    // Whether the JVM heap was running low after the previous JVM GC.
+    // Accessed on: Event thread only.
+    private static boolean jvmHeapWasLow = false;
+
+    // System.nanoTime() of the last critical memory release, if any.
+    // Accessed on: Event thread only.
+    private static boolean criticalReleaseDone = false;
+    private static long lastCriticalReleaseTime;
+
     private static void collectJSCGarbages() {
         Invoker.getInvoker().checkEventThread();
         // Add dummy object to get notification as soon as it is collected
         // by the JVM GC.
         Disposer.addRecord(new Object(), WebPage::collectJSCGarbages);
-        // Invoke JavaScriptCore GC.
-        twkDoJSCGarbageCollection();
+        // Invoke JavaScriptCore GC, with a critical memory release when the
+        // JVM heap itself is running low. A single sample is not trusted:
+        // after a young collection the old generation may still be full of
+        // garbage, so the heap has to be low after two JVM GCs in a row.
+        Runtime runtime = Runtime.getRuntime();
+        long used = runtime.totalMemory() - runtime.freeMemory();
+        boolean jvmHeapIsLow = used > runtime.maxMemory() / 10 * 9;
+        long now = System.nanoTime();
+        boolean critical = jvmHeapIsLow && jvmHeapWasLow
+                && (!criticalReleaseDone
+                    || now - lastCriticalReleaseTime >= CRITICAL_RELEASE_INTERVAL_NANOS);
+        jvmHeapWasLow = jvmHeapIsLow && !critical;
+        if (critical) {
+            criticalReleaseDone = true;
+            lastCriticalReleaseTime = now;
+        }
+        twkDoJSCGarbageCollection(critical);
     }
 
     public WebPage(WebPageClient pageClient,
@@ -271,6 +346,15 @@ public final class WebPage {
             }
         }
         dirtyRects.add(toPaint);
+        // Each dirty rect costs a separate paint pass and render queue,
+        // so collapse scattered invalidations into their bounding rect.
+        if (dirtyRects.size() > MAX_DIRTY_RECTS) {
+            WCRectangle union = dirtyRects.remove(0);
+            while (!dirtyRects.isEmpty()) {
+                union = union.createUnion(dirtyRects.remove(0));
+            }
+            dirtyRects.add(union);
+        }
     }
 
     public boolean isDirty() {
@@ -300,12 +384,17 @@ public final class WebPage {
         }
         List<WCRectangle> oldDirtyRects = dirtyRects;
         dirtyRects = new LinkedList<WCRectangle>();
+        Set<Long> updatedTiles = new HashSet<Long>();
         twkPrePaint(getPage());
         while (!oldDirtyRects.isEmpty()) {
             WCRectangle r = oldDirtyRects.remove(0).intersection(clip);
             if (r.getWidth() <= 0 || r.getHeight() <= 0) {
                 continue;
             }
+            if (retainedTiles != null) {
+                updateTiles(r, updatedTiles);
+                continue;
+            }
             paintLog.finest("Updating: {0}", r);
             WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
                     .createRenderQueue(r, true);
@@ -367,6 +456,79 @@ public final class WebPage {
         }
     }
 
+    /*
+     * Adds the render queues of the tiles intersecting the given rect to the
+     * current frame. A retained tile is replayed as is, the others are painted
+     * by WebKit and retained unless they got invalidated while painting.
+     */
+    private void updateTiles(WCRectangle r, Set<Long> updatedTiles) {
+        WCRectangle pageRect = new WCRectangle(0, 0, width, height);
+        int minCol = r.getIntX() / TILE_SIZE;
+        int minRow = r.getIntY() / TILE_SIZE;
+        int maxCol = ((int) Math.ceil(r.getMaxX()) - 1) / TILE_SIZE;
+        int maxRow = ((int) Math.ceil(r.getMaxY()) - 1) / TILE_SIZE;
+        for (int row = minRow; row <= maxRow; row++) {
+            for (int col = minCol; col <= maxCol; col++) {
+                long key = ((long) row << 32) | col;
+                if (!updatedTiles.add(key)) {
+                    continue;
+                }
+                WCRenderQueue rq = retainedTiles.get(key);
+                if (rq != null) {
+                    paintLog.finest("Replaying: {0}", rq.getClip());
+                    if (!rq.isEmpty()) {
+                        rq.retain();
+                        currentFrame.addRenderQueue(rq);
+                    }
+                    continue;
+                }
+                WCRectangle tile = new WCRectangle(col * TILE_SIZE,
+                        row * TILE_SIZE, TILE_SIZE, TILE_SIZE)
+                        .intersection(pageRect);
+                if (tile.isEmpty()) {
+                    continue;
+                }
+                paintLog.finest("Updating: {0}", tile);
+                rq = WCGraphicsManager.getGraphicsManager()
+                        .createRenderQueue(tile, true);
+                twkUpdateContent(getPage(), rq, tile.getIntX() - 1,
+                        tile.getIntY() - 1, tile.getIntWidth() + 2,
+                        tile.getIntHeight() + 2);
+                currentFrame.addRenderQueue(rq);
+                if (!intersectsDirtyRects(tile)) {
+                    rq.retain();
+                    retainedTiles.put(key, rq);
+                }
+            }
+        }
+    }
+
+    private boolean intersectsDirtyRects(WCRectangle r) {
+        for (WCRectangle dirty : dirtyRects) {
+            if (!dirty.intersection(r).isEmpty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /*
+     * Drops the retained tiles intersecting the given rect,
+     * or all of them if the rect is null.
+     */
+    private void invalidateTiles(WCRectangle r) {
+        if (retainedTiles == null) {
+            return;
+        }
+        for (Iterator<WCRenderQueue> it = retainedTiles.values().iterator(); it.hasNext();) {
+            WCRenderQueue rq = it.next();
+            if (r == null || !rq.getClip().intersection(r).isEmpty()) {
+                it.remove();
+                rq.dispose();
+            }
+        }
+    }
+
     private void scroll(int x, int y, int w, int h, int dx, int dy) {
         if (paintLog.isLoggable(Level.FINEST)) {
             paintLog.finest("rect=[" + x + ", " + y + " " + w + "x" + h +
@@ -539,6 +701,7 @@ public final class WebPage {
             }
             width = w;
             height = h;
+            invalidateTiles(null);
             twkSetBounds(getPage(), 0, 0, w, h);
             // In response to the above call, WebKit will issue many
             // repaint requests, one of which will be meant to invalidate
@@ -575,6 +738,7 @@ public final class WebPage {
             if (!frames.contains(frameID)) {
                 return;
             }
+            invalidateTiles(null);
             twkSetTransparent(frameID, !isOpaque);
 
         } finally {
@@ -593,6 +757,7 @@ public final class WebPage {
             if (!frames.contains(frameID)) {
                 return;
             }
+            invalidateTiles(null);
             twkSetBackgroundColor(frameID, backgroundColor);
 
         } finally {
@@ -610,6 +775,7 @@ public final class WebPage {
                 return;
             }
 
+            invalidateTiles(null);
             for (long frameID: frames) {
                 twkSetBackgroundColor(frameID, backgroundColor);
             }
@@ -1010,6 +1176,7 @@ public final class WebPage {
 
             stop();
             dropRenderFrames();
+            invalidateTiles(null);
             isDisposed = true;
 
             twkDestroyPage(pPage);
@@ -2108,7 +2275,9 @@ public final class WebPage {
                 paintLog.finest("x: {0}, y: {1}, w: {2}, h: {3}",
                         new Object[] {x, y, w, h});
             }
-            addDirtyRect(new WCRectangle(x, y, w, h));
+            WCRectangle r = new WCRectangle(x, y, w, h);
+            invalidateTiles(r);
+            addDirtyRect(r);
         } finally {
             unlockPage();
         }
@@ -2118,6 +2287,8 @@ public final class WebPage {
         if (paintLog.isLoggable(Level.FINEST)) {
             paintLog.finest("Scroll: " + x + " " + y + " " + w + " " + h + "  " + deltaX + " " + deltaY);
         }
+        // The retained tiles are in the view coordinates
+        invalidateTiles(null);
         if (pageClient == null || !pageClient.isBackBufferSupported()) {
             paintLog.finest("blit scrolling is switched off");
             // TODO: check why we return void, not boolean (see ScrollView::m_canBlitOnScroll)
@@ -2460,6 +2631,7 @@ public final class WebPage {
 
     private void fwkRepaintAll() {
         log.fine("Repainting the entire page");
+        invalidateTiles(null);
         repaintAll();
     }
 
@@ -2487,6 +2659,93 @@ public final class WebPage {
 
     private static native int twkWorkerThreadCount();
 
+    // ---- Sampling profiler support ---- //
+
+    /**
+     * Starts sampling the JavaScript stacks. All pages share one JavaScript
+     * VM, so the samples cover the scripts of every page.
+     *
+     * @param intervalMicros the sampling interval in microseconds, or 0 to
+     *        use the default
+     */
+    public static void startSamplingProfiler(int intervalMicros) {
+        Invoker.getInvoker().checkEventThread();
+        twkStartSamplingProfiler(intervalMicros);
+    }
+
+    /**
+     * Stops sampling and returns the stacks collected since
+     * {@link #startSamplingProfiler} in folded format: one
+     * {@code outer;...;inner count} line per distinct stack.
+     *
+     * @return the folded stacks, or null if sampling is not supported
+     */
+    public static String stopSamplingProfiler() {
+        Invoker.getInvoker().checkEventThread();
+        return twkStopSamplingProfiler();
+    }
+
+    private static native void twkStartSamplingProfiler(int intervalMicros);
+    private static native String twkStopSamplingProfiler();
+
+    // ---- Memory cache support ---- //
+
+    /**
+     * Sets the capacities of the memory cache shared by all pages, in bytes.
+     * Lowering them prunes the cache immediately.
+     *
+     * @param minDeadBytes the bytes that resources no page uses may keep
+     *        when the cache is under pressure
+     * @param maxDeadBytes the bytes that resources no page uses may keep
+     *        otherwise
+     * @param totalBytes the bytes the cache may use overall
+     * @throws IllegalArgumentException unless
+     *         {@code 0 <= minDeadBytes <= maxDeadBytes <= totalBytes}
+     */
+    public static void setMemoryCacheCapacities(int minDeadBytes, int maxDeadBytes, int totalBytes) {
+        Invoker.getInvoker().checkEventThread();
+        if (minDeadBytes < 0 || minDeadBytes > maxDeadBytes || maxDeadBytes > totalBytes) {
+            throw new IllegalArgumentException("Invalid memory cache capacities: "
+                    + minDeadBytes + ", " + maxDeadBytes + ", " + totalBytes);
+        }
+        twkSetMemoryCacheCapacities(minDeadBytes, maxDeadBytes, totalBytes);
+    }
+
+    /**
+     * Returns the memory cache counters accumulated since the process
+     * started: requests served from the cache, requests revalidated,
+     * requests loaded from the network, bytes of resources evicted, and
+     * bytes of decoded data destroyed. The last element is the current
+     * size of the cache in bytes.
+     *
+     * @return the counters, in the order listed above
+     */
+    public static long[] getMemoryCacheStatistics() {
+        Invoker.getInvoker().checkEventThread();
+        return twkGetMemoryCacheStatistics();
+    }
+
+    private static native void twkSetMemoryCacheCapacities(int minDeadBytes, int maxDeadBytes, int totalBytes);
+    private static native long[] twkGetMemoryCacheStatistics();
+
+    // ---- JavaScript bridge support ---- //
+
+    /**
+     * Sets whether direct NIO buffers passed to JavaScript are exposed as
+     * an {@code ArrayBuffer}, or a typed array for native order views,
+     * that shares the buffer memory. Otherwise, and for read-only buffers,
+     * they are bridged as Java objects. The initial value comes from the
+     * {@code com.sun.webkit.shareDirectBuffers} system property.
+     *
+     * @param share whether to share direct buffers as typed arrays
+     */
+    public static void setShareDirectBuffers(boolean share) {
+        Invoker.getInvoker().checkEventThread();
+        twkSetShareDirectBuffers(share);
+    }
+
+    private static native void twkSetShareDirectBuffers(boolean share);
+
     private void fwkDidClearWindowObject(long pContext, long pWindowObject) {
         if (pageClient != null) {
             pageClient.didClearWindowObject(pContext, pWindowObject);
@@ -2536,7 +2795,7 @@ public final class WebPage {
     // Native methods
     // *************************************************************************
 
-    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useCSS3D);
+    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useFTLJIT, boolean useCSS3D, boolean useNativeImageDecoders, int parserTimeLimit, int pulseRate, int jsHeapBudget);
     private native long twkCreatePage(boolean editable);
     private native void twkInit(long pPage, boolean usePlugins, float devicePixelScale);
     private native void twkDestroyPage(long pPage);
@@ -2664,5 +2923,5 @@ public final class WebPage {
     private native void twkDisconnectInspectorFrontend(long pPage);
     private native void twkDispatchInspectorMessageFromFrontend(long pPage,
                                                                 String message);
-    private static native void twkDoJSCGarbageCollection();
+    private static native void twkDoJSCGarbageCollection(boolean lowMemory);
 }
@@ -300,8 +300,8 @@ public final class GraphicsDecoder  {
                 case DRAWSTRING_FAST:
                     gc.drawString(
                         (WCFont) gm.getRef(buf.getInt()),
-                        bdata.getIntArray(buf.getInt()), //glyphs
-                        bdata.getFloatArray(buf.getInt()), //offsets
+                        getIntArray(buf),   // glyphs
+                        getFloatArray(buf), // advances
                         buf.getFloat(),
                         buf.getFloat());
                     break;
@@ -447,11 +447,17 @@ public final class GraphicsDecoder  {
         return 0 != buf.getInt();
     }
 
+    private static int[] getIntArray(ByteBuffer buf) {
+        int[] array = new int[buf.getInt()];
+        buf.asIntBuffer().get(array);
+        buf.position(buf.position() + array.length * Integer.BYTES);
+        return array;
+    }
+
     private static float[] getFloatArray(ByteBuffer buf) {
         float[] array = new float[buf.getInt()];
-        for (int i = 0; i < array.length; i++) {
-            array[i] = buf.getFloat();
-        }
+        buf.asFloatBuffer().get(array);
+        buf.position(buf.position() + array.length * Float.BYTES);
         return array;
     }
 
@@ -37,7 +37,12 @@ public abstract class WCFont extends Ref {
 
     public abstract float getXHeight();
 
-    public abstract double getGlyphWidth(int glyph);
+    /**
+     * Returns the advances of {@code count} consecutive glyphs starting
+     * with {@code firstGlyph}.
+     * NB: This method is called from native code!
+     */
+    public abstract float[] getGlyphWidths(int firstGlyph, int count);
 
     public abstract float[] getGlyphBoundingBox(int glyph);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -80,6 +80,13 @@ public abstract class WCPath<P> extends Ref {
 
     public abstract void addPath(WCPath path);
 
+    /**
+     * Appends the segments recorded by the native code in bulk.
+     * @param types the {@link WCPathIterator} segment types
+     * @param coords the coordinates of all the segments, packed in order
+     */
+    public abstract void addSegments(int[] types, float[] coords);
+
     public abstract void closeSubpath();
 
     public abstract boolean hasCurrentPoint();
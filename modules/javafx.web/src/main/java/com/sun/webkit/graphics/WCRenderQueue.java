@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,8 @@ public abstract class WCRenderQueue extends Ref {
     private final WCRectangle clip;
     private int size = 0;
     private final boolean opaque;
+    // The number of additional holders of this queue, see retain().
+    private int retainCount = 0;
 
     // Associated graphics context (currently used to draw to a buffered image).
     protected final WCGraphicsContext gc;
@@ -73,7 +75,7 @@ public abstract class WCRenderQueue extends Ref {
         currentBuffer.setBuffer(buffer);
         buffers.addLast(currentBuffer);
         currentBuffer = new BufferData();
-        size += buffer.capacity();
+        size += buffer.limit();
         if (size > MAX_QUEUE_SIZE && gc!=null) {
             // It is isolated queue over the canvas image [image-gc!=null].
             // We need to flush the changes periodically
@@ -116,7 +118,12 @@ public abstract class WCRenderQueue extends Ref {
         flush();
     }
 
-    private void fwkAddBuffer(ByteBuffer buffer) {
+    /*is called from native*/
+    private void fwkAddBuffer(ByteBuffer buffer, int length) {
+        // The native side reuses direct buffers once they are released,
+        // so the buffer covers the whole native storage.
+        buffer.clear();
+        buffer.limit(length);
         addBuffer(buffer);
     }
 
@@ -124,7 +131,25 @@ public abstract class WCRenderQueue extends Ref {
         return clip;
     }
 
+    /**
+     * Registers an additional holder of this queue, so the queue can be
+     * decoded once per holder (e.g. replayed from a cache of recorded
+     * queues). Every holder is expected to call {@link #dispose()} when it
+     * is done with the queue; the buffers are released by the last one.
+     */
+    public synchronized void retain() {
+        retainCount++;
+    }
+
     public synchronized void dispose() {
+        if (retainCount > 0) {
+            retainCount--;
+            // Rewind the buffers for the next holder to decode them again
+            for (BufferData bdata: buffers) {
+                bdata.getBuffer().rewind();
+            }
+            return;
+        }
         int n = buffers.size();
         if (n > 0) {
             int i = 0;
@@ -157,16 +182,6 @@ public abstract class WCRenderQueue extends Ref {
         return currentBuffer.addString(str);
     }
 
-    /*is called from native*/
-    private int refIntArr(int[] arr) {
-        return currentBuffer.addIntArray(arr);
-    }
-
-    /*is called from native*/
-    private int refFloatArr(float[] arr) {
-        return currentBuffer.addFloatArray(arr);
-    }
-
     public boolean isOpaque() {
         return opaque;
     }
@@ -185,10 +200,6 @@ final class BufferData {
     private final AtomicInteger idCount = new AtomicInteger(0);
     private final HashMap<Integer,String> strMap =
             new HashMap<Integer,String>();
-    private final HashMap<Integer,int[]> intArrMap =
-            new HashMap<Integer,int[]>();
-    private final HashMap<Integer,float[]> floatArrMap =
-            new HashMap<Integer,float[]>();
 
     private ByteBuffer buffer;
 
@@ -196,26 +207,6 @@ final class BufferData {
         return idCount.incrementAndGet();
     }
 
-    int addIntArray(int[] a) {
-        int id = createID();
-        intArrMap.put(id, a);
-        return id;
-    }
-
-    int[] getIntArray(int id) {
-        return intArrMap.get(id);
-    }
-
-    int addFloatArray(float[] a) {
-        int id = createID();
-        floatArrMap.put(id, a);
-        return id;
-    }
-
-    float[] getFloatArray(int id) {
-        return floatArrMap.get(id);
-    }
-
     int addString(String s) {
         int id = createID();
         strMap.put(id, s);
@@ -63,9 +63,16 @@ final class NetworkContext {
     private static final int DEFAULT_HTTP_MAX_CONNECTIONS = 5;
 
     /**
-     * The buffer size for the shared pool of byte buffers.
+     * The default size of the chunks in which response data is
+     * handed over to WebCore.
      */
-    private static final int BYTE_BUFFER_SIZE = 1024 * 40;
+    private static final int DEFAULT_CHUNK_SIZE = 1024 * 40;
+
+    /**
+     * The bounds for the "com.sun.webkit.network.chunkSize" system property.
+     */
+    private static final int MIN_CHUNK_SIZE = 1024 * 4;
+    private static final int MAX_CHUNK_SIZE = 1024 * 1024 * 4;
 
     /**
      * The thread pool used to execute asynchronous loaders.
@@ -83,10 +90,17 @@ final class NetworkContext {
     }
 
     /**
-     * The shared pool of byte buffers.
+     * The size of the chunks in which response data is handed over
+     * to WebCore.
      */
-    private static final ByteBufferPool byteBufferPool =
-            ByteBufferPool.newInstance(BYTE_BUFFER_SIZE);
+    private static final int chunkSize = AccessController.doPrivileged(
+            (PrivilegedAction<Integer>) () -> {
+                int size = Integer.getInteger(
+                        "com.sun.webkit.network.chunkSize",
+                        DEFAULT_CHUNK_SIZE);
+                return Math.max(MIN_CHUNK_SIZE,
+                                Math.min(size, MAX_CHUNK_SIZE));
+            });
 
 
     /**
@@ -145,7 +159,7 @@ final class NetworkContext {
         }
         URLLoader loader = new URLLoader(
                 webPage,
-                byteBufferPool,
+                chunkSize,
                 asynchronous,
                 url,
                 method,
@@ -58,6 +58,7 @@ import java.util.List;
 import java.util.Locale;
 import java.util.Map;
 import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.Semaphore;
 import java.util.zip.GZIPInputStream;
 import java.util.zip.InflaterInputStream;
 import javax.net.ssl.SSLHandshakeException;
@@ -79,7 +80,7 @@ final class URLLoader implements Runnable {
 
 
     private final WebPage webPage;
-    private final ByteBufferPool byteBufferPool;
+    private final int chunkSize;
     private final boolean asynchronous;
     private String url;
     private String method;
@@ -93,7 +94,7 @@ final class URLLoader implements Runnable {
      * Creates a new {@code URLLoader}.
      */
     URLLoader(WebPage webPage,
-              ByteBufferPool byteBufferPool,
+              int chunkSize,
               boolean asynchronous,
               String url,
               String method,
@@ -102,7 +103,7 @@ final class URLLoader implements Runnable {
               long data)
     {
         this.webPage = webPage;
-        this.byteBufferPool = byteBufferPool;
+        this.chunkSize = chunkSize;
         this.asynchronous = asynchronous;
         this.url = url;
         this.method = method;
@@ -546,9 +547,11 @@ final class URLLoader implements Runnable {
             }
         }
 
-        ByteBufferAllocator allocator =
-                byteBufferPool.newAllocator(MAX_BUF_COUNT);
-        ByteBuffer byteBuffer = null;
+        // The expected number of bytes still to come, if it is known up
+        // front, so that the last chunk is not oversized
+        long expected = encoding == null ? extractContentLength(c) : -1;
+        Semaphore chunkPermits = new Semaphore(MAX_BUF_COUNT);
+        Chunk chunk = null;
         try {
             if (inputStream != null) {
                 // 8192 is the default size of a BufferedInputStream used in
@@ -569,40 +572,39 @@ final class URLLoader implements Runnable {
                         break;
                     }
 
-                    if (byteBuffer == null) {
-                        byteBuffer = allocator.allocate();
+                    if (chunk == null) {
+                        chunk = allocateChunk(chunkPermits, expected);
                     }
 
-                    int remaining = byteBuffer.remaining();
+                    int remaining = chunk.buffer.remaining();
                     if (count < remaining) {
-                        byteBuffer.put(buffer, 0, count);
+                        chunk.buffer.put(buffer, 0, count);
                     } else {
-                        byteBuffer.put(buffer, 0, remaining);
+                        chunk.buffer.put(buffer, 0, remaining);
 
-                        byteBuffer.flip();
-                        didReceiveData(byteBuffer, allocator);
-                        byteBuffer = null;
+                        expected -= chunk.buffer.position();
+                        didReceiveData(chunk, chunkPermits);
+                        chunk = null;
 
                         int outstanding = count - remaining;
                         if (outstanding > 0) {
-                            byteBuffer = allocator.allocate();
-                            byteBuffer.put(buffer, remaining, outstanding);
+                            chunk = allocateChunk(chunkPermits, expected);
+                            chunk.buffer.put(buffer, remaining, outstanding);
                         }
                     }
                 }
             }
             if (!canceled) {
-                if (byteBuffer != null && byteBuffer.position() > 0) {
-                    byteBuffer.flip();
-                    didReceiveData(byteBuffer, allocator);
-                    byteBuffer = null;
+                if (chunk != null && chunk.buffer.position() > 0) {
+                    didReceiveData(chunk, chunkPermits);
+                    chunk = null;
                 }
                 didFinishLoading();
             }
         } finally {
-            if (byteBuffer != null) {
-                byteBuffer.clear();
-                allocator.release(byteBuffer);
+            if (chunk != null) {
+                twkDisposeChunk(chunk.handle);
+                chunkPermits.release();
             }
         }
         return null;
@@ -639,6 +641,21 @@ final class URLLoader implements Runnable {
         }
     }
 
+    /**
+     * A natively allocated block of response data. Once delivered,
+     * the native side adopts the memory as a SharedBuffer segment,
+     * so the bytes are not copied again.
+     */
+    private static final class Chunk {
+        private final long handle;
+        private final ByteBuffer buffer;
+
+        private Chunk(long handle, ByteBuffer buffer) {
+            this.handle = handle;
+            this.buffer = buffer;
+        }
+    }
+
     /**
      * Signals an invalid response from the server.
      */
@@ -823,37 +840,52 @@ final class URLLoader implements Runnable {
                 data);
     }
 
-    private void didReceiveData(final ByteBuffer byteBuffer,
-                                final ByteBufferAllocator allocator)
+    /**
+     * Allocates a natively owned chunk, blocking while {@code MAX_BUF_COUNT}
+     * chunks of this loader are still waiting to be delivered.
+     */
+    private Chunk allocateChunk(Semaphore chunkPermits, long expected)
+        throws InterruptedException
+    {
+        int capacity = chunkSize;
+        if (expected > 0 && expected < capacity) {
+            capacity = (int) expected;
+        }
+        chunkPermits.acquire();
+        long handle = twkCreateChunk(capacity);
+        if (handle == 0) {
+            chunkPermits.release();
+            throw new OutOfMemoryError("Unable to allocate "
+                    + capacity + " bytes for response data");
+        }
+        return new Chunk(handle, twkGetChunkBuffer(handle));
+    }
+
+    private void didReceiveData(final Chunk chunk,
+                                final Semaphore chunkPermits)
     {
+        final int length = chunk.buffer.position();
         callBack(() -> {
             if (!canceled) {
-                notifyDidReceiveData(
-                        byteBuffer,
-                        byteBuffer.position(),
-                        byteBuffer.remaining());
+                notifyDidReceiveData(chunk, length);
+            } else {
+                twkDisposeChunk(chunk.handle);
             }
-            byteBuffer.clear();
-            allocator.release(byteBuffer);
+            chunkPermits.release();
         });
     }
 
-    private void notifyDidReceiveData(ByteBuffer byteBuffer,
-                                      int position,
-                                      int remaining)
-    {
+    private void notifyDidReceiveData(Chunk chunk, int length) {
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(String.format(
-                    "byteBuffer: [%s], "
-                    + "position: [%s], "
-                    + "remaining: [%s], "
+                    "chunk: [0x%016X], "
+                    + "length: [%s], "
                     + "data: [0x%016X]",
-                    byteBuffer,
-                    position,
-                    remaining,
+                    chunk.handle,
+                    length,
                     data));
         }
-        twkDidReceiveData(byteBuffer, position, remaining, data);
+        twkDidReceiveData(chunk.handle, length, data);
     }
 
     private void didFinishLoading() {
@@ -925,9 +957,14 @@ final class URLLoader implements Runnable {
                                                      String url,
                                                      long data);
 
-    private static native void twkDidReceiveData(ByteBuffer byteBuffer,
-                                                 int position,
-                                                 int remaining,
+    private static native long twkCreateChunk(int capacity);
+
+    private static native ByteBuffer twkGetChunkBuffer(long chunk);
+
+    private static native void twkDisposeChunk(long chunk);
+
+    private static native void twkDidReceiveData(long chunk,
+                                                 int length,
                                                  long data);
 
     private static native void twkDidFinishLoading(long data);
@@ -85,10 +85,10 @@ public final class WCFontPerfLogger extends WCFont {
         return res;
     }
 
-    public double getGlyphWidth(int glyph) {
-        logger.resumeCount("GETGLYPHWIDTH");
-        double res = fnt.getGlyphWidth(glyph);
-        logger.suspendCount("GETGLYPHWIDTH");
+    public float[] getGlyphWidths(int firstGlyph, int count) {
+        logger.resumeCount("GETGLYPHWIDTHS");
+        float[] res = fnt.getGlyphWidths(firstGlyph, count);
+        logger.suspendCount("GETGLYPHWIDTHS");
         return res;
     }
 
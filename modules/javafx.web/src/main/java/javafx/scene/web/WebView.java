@@ -113,6 +113,10 @@ final public class WebView extends Parent {
     private static final double DEFAULT_MAX_WIDTH = Double.MAX_VALUE;
     private static final double DEFAULT_MAX_HEIGHT = Double.MAX_VALUE;
 
+    // The maximum number of consecutive stage pulses on which the page
+    // update may be skipped while the previous render queues are pending.
+    private static final int MAX_SKIPPED_PULSES = 2;
+
     private final WebPage page;
     private final WebEngine engine;
     private volatile InputMethodClientImpl imClient;
@@ -936,6 +940,10 @@ final public class WebView extends Parent {
                && !iconified;
     }
 
+    // The number of consecutive stage pulses on which the page update
+    // was skipped because the previous render queues were still pending.
+    private int skippedPulses;
+
     private void handleStagePulse() {
         // The stage pulse occurs before the scene pulse.
         // Here the page content is updated before CSS/Layout/Sync pass
@@ -957,6 +965,19 @@ final public class WebView extends Parent {
 
         if (reallyVisible) {
             if (page.isDirty()) {
+                // Skip this pulse if the render queues created on the
+                // previous one haven't been rendered yet. The dirty rects
+                // keep accumulating in the page and get painted in one go
+                // on the next pulse, instead of producing frames that
+                // would only be dropped by the frame queue.
+                if (page.isRepaintPending()
+                        && skippedPulses < MAX_SKIPPED_PULSES) {
+                    skippedPulses++;
+                    NodeHelper.markDirty(this, DirtyBits.WEBVIEW_VIEW);
+                    Toolkit.getToolkit().requestNextPulse();
+                    return;
+                }
+                skippedPulses = 0;
                 SceneHelper.setAllowPGAccess(true);
                 final NGWebView peer = NodeHelper.getPeer(this);
                 peer.update(); // creates new render queues
@@ -43,11 +43,23 @@ void CodeCacheMap::pruneSlowCase()
 
     while (m_size > m_capacity || !canPruneQuickly()) {
         MapType::iterator it = m_map.begin();
-        m_size -= it->key.length();
-        m_map.remove(it);
+        while (it->value.retained)
+            ++it;
+        remove(it);
     }
 }
 
+void CodeCacheMap::removeLeastRecentlyUsedRetained()
+{
+    MapType::iterator leastRecentlyUsed = m_map.end();
+    for (MapType::iterator it = m_map.begin(); it != m_map.end(); ++it) {
+        if (it->value.retained && (leastRecentlyUsed == m_map.end() || it->value.age < leastRecentlyUsed->value.age))
+            leastRecentlyUsed = it;
+    }
+    ASSERT(leastRecentlyUsed != m_map.end());
+    remove(leastRecentlyUsed);
+}
+
 template <class UnlinkedCodeBlockType, class ExecutableType>
 UnlinkedCodeBlockType* CodeCache::getUnlinkedGlobalCodeBlock(VM& vm, ExecutableType* executable, const SourceCode& source, JSParserStrictMode strictMode, JSParserScriptMode scriptMode, DebuggerMode debuggerMode, ParserError& error, EvalContextType evalContextType)
 {
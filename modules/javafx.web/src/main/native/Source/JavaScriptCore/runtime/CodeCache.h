@@ -71,6 +71,7 @@ struct SourceCodeValue {
 
     Strong<JSCell> cell;
     int64_t age;
+    bool retained { false };
 };
 
 class CodeCacheMap {
@@ -81,6 +82,8 @@ public:
 
     CodeCacheMap()
         : m_size(0)
+        , m_retainedSize(0)
+        , m_retainedAge(0)
         , m_sizeAtLastPrune(0)
         , m_timeAtLastPrune(MonotonicTime::now())
         , m_minCapacity(0)
@@ -97,6 +100,11 @@ public:
         if (findResult == m_map.end())
             return nullptr;
 
+        if (findResult->value.retained) {
+            findResult->value.age = ++m_retainedAge;
+            return &findResult->value;
+        }
+
         int64_t age = m_age - findResult->value.age;
         if (age > m_capacity) {
             // A requested object is older than the cache's capacity. We can
@@ -122,23 +130,40 @@ public:
     {
         prune();
 
+        int64_t length = key.length();
+        bool retain = length >= retainedMinLength && length <= retainedMaxLength;
+        if (retain) {
+            while (m_retainedSize + length > retainedMaxLength)
+                removeLeastRecentlyUsedRetained();
+        }
+
         AddResult addResult = m_map.add(key, value);
         ASSERT(addResult.isNewEntry);
 
-        m_size += key.length();
+        if (retain) {
+            addResult.iterator->value.retained = true;
+            addResult.iterator->value.age = ++m_retainedAge;
+            m_retainedSize += length;
+        } else
+            m_size += length;
         m_age += key.length();
         return addResult;
     }
 
     void remove(iterator it)
     {
-        m_size -= it->key.length();
+        if (it->value.retained)
+            m_retainedSize -= it->key.length();
+        else
+            m_size -= it->key.length();
         m_map.remove(it);
     }
 
     void clear()
     {
         m_size = 0;
+        m_retainedSize = 0;
+        m_retainedAge = 0;
         m_age = 0;
         m_map.clear();
     }
@@ -161,10 +186,21 @@ private:
     // sample them, so we need to extrapolate from the ones we do sample.
     static const int64_t oldObjectSamplingMultiplier = 32;
 
+    // Large sources, typically application bundles, are the most expensive
+    // ones to parse and generate bytecode for again. Up to retainedMaxLength
+    // characters of them are exempt from the age based pruning above. When
+    // that budget is full, the least recently used one makes room for a new
+    // one; they all go away when the whole cache is cleared, e.g. on memory
+    // pressure. Retained entries keep their own age, which only counts uses.
+    static const int64_t retainedMinLength = 64 * 1024;
+    static const int64_t retainedMaxLength = 32000000;
+    static_assert(static_cast<size_t>(retainedMaxLength / retainedMinLength) < workingSetMaxEntries, "pruning must always find an entry that isn't retained");
+
     size_t numberOfEntries() const { return static_cast<size_t>(m_map.size()); }
     bool canPruneQuickly() const { return numberOfEntries() < workingSetMaxEntries; }
 
     void pruneSlowCase();
+    void removeLeastRecentlyUsedRetained();
     void prune()
     {
         if (m_size <= m_capacity && canPruneQuickly())
@@ -180,6 +216,8 @@ private:
 
     MapType m_map;
     int64_t m_size;
+    int64_t m_retainedSize;
+    int64_t m_retainedAge;
     int64_t m_sizeAtLastPrune;
     MonotonicTime m_timeAtLastPrune;
     int64_t m_minCapacity;
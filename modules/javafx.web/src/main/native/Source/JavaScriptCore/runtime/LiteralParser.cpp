@@ -37,6 +37,7 @@
 #include "StrongInlines.h"
 #include <wtf/ASCIICType.h>
 #include <wtf/dtoa.h>
+#include <wtf/text/ASCIIFastPath.h>
 #include <wtf/text/StringConcatenate.h>
 
 namespace JSC {
@@ -49,6 +50,57 @@ static ALWAYS_INLINE bool isJSONWhiteSpace(const CharType& c)
     return c == ' ' || c == 0x9 || c == 0xA || c == 0xD;
 }
 
+// Latin-1 sources are scanned a machine word at a time. A word is skipped when none of
+// its bytes is a control character, a backslash or the terminator; the first word that
+// may contain one is left to the per character loops.
+static ALWAYS_INLINE MachineWord byteMaskFor(LChar c)
+{
+    return (static_cast<MachineWord>(-1) / 0xFF) * c;
+}
+
+static ALWAYS_INLINE bool wordHasZeroByte(MachineWord word)
+{
+    return (word - byteMaskFor(0x01)) & ~word & byteMaskFor(0x80);
+}
+
+static ALWAYS_INLINE const LChar* skipSafeStringCharacterWords(const LChar* ptr, const LChar* end, LChar terminator)
+{
+    while (end - ptr >= static_cast<ptrdiff_t>(sizeof(MachineWord))) {
+        MachineWord word;
+        memcpy(&word, ptr, sizeof(MachineWord));
+        bool hasControl = (word - byteMaskFor(' ')) & ~word & byteMaskFor(0x80);
+        if (hasControl || wordHasZeroByte(word ^ byteMaskFor('\\')) || wordHasZeroByte(word ^ byteMaskFor(terminator)))
+            break;
+        ptr += sizeof(MachineWord);
+    }
+    return ptr;
+}
+
+static ALWAYS_INLINE const UChar* skipSafeStringCharacterWords(const UChar* ptr, const UChar*, UChar)
+{
+    return ptr;
+}
+
+static ALWAYS_INLINE const LChar* skipSpaceWords(const LChar* ptr, const LChar* end)
+{
+    // Indented JSON has long runs of spaces before keys; only bother when one starts here.
+    if (end - ptr < static_cast<ptrdiff_t>(sizeof(MachineWord)) || ptr[0] != ' ' || ptr[1] != ' ')
+        return ptr;
+    while (end - ptr >= static_cast<ptrdiff_t>(sizeof(MachineWord))) {
+        MachineWord word;
+        memcpy(&word, ptr, sizeof(MachineWord));
+        if (word != byteMaskFor(' '))
+            break;
+        ptr += sizeof(MachineWord);
+    }
+    return ptr;
+}
+
+static ALWAYS_INLINE const UChar* skipSpaceWords(const UChar* ptr, const UChar*)
+{
+    return ptr;
+}
+
 template <typename CharType>
 bool LiteralParser<CharType>::tryJSONPParse(Vector<JSONPData>& results, bool needsFullSourceInfo)
 {
@@ -440,6 +492,7 @@ ALWAYS_INLINE TokenType LiteralParser<CharType>::Lexer::lex(LiteralParserToken<C
     m_currentTokenID++;
 #endif
 
+    m_ptr = skipSpaceWords(m_ptr, m_end);
     while (m_ptr < m_end && isJSONWhiteSpace(*m_ptr))
         ++m_ptr;
 
@@ -589,6 +642,7 @@ ALWAYS_INLINE TokenType LiteralParser<CharType>::Lexer::lexString(LiteralParserT
     const CharType* runStart = m_ptr;
 
     if (m_mode == StrictJSON) {
+        m_ptr = skipSafeStringCharacterWords(m_ptr, m_end, terminator);
         while (m_ptr < m_end && isSafeStringCharacter<SafeStringCharacterSet::Strict>(*m_ptr, terminator))
             ++m_ptr;
     } else {
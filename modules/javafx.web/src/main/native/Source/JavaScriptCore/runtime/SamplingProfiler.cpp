@@ -909,6 +909,65 @@ String SamplingProfiler::stackTracesAsJSON()
     return json.toString();
 }
 
+String SamplingProfiler::stackTracesAsFoldedStacks()
+{
+    DeferGC deferGC(m_vm.heap);
+    LockHolder locker(m_lock);
+
+    {
+        HeapIterationScope heapIterationScope(m_vm.heap);
+        processUnverifiedStackTraces();
+    }
+
+    // Identical stacks are merged into one line, listed from the outermost frame
+    // to the innermost one and followed by their sample count, which is the input
+    // format of most flame graph tools.
+    HashMap<String, unsigned> stackCounts;
+    Vector<String> stacks;
+    for (StackTrace& stackTrace : m_stackTraces) {
+        if (stackTrace.frames.isEmpty())
+            continue;
+
+        StringBuilder stack;
+        for (size_t i = stackTrace.frames.size(); i--;) {
+            StackFrame& stackFrame = stackTrace.frames[i];
+            StringBuilder frame;
+            String name = stackFrame.displayName(m_vm);
+            if (name.isEmpty())
+                name = "(anonymous function)"_s;
+            frame.append(name);
+            String url = stackFrame.url();
+            if (!url.isEmpty()) {
+                frame.append(' ');
+                frame.append(url);
+                frame.append(':');
+                frame.appendNumber(stackFrame.functionStartLine());
+            }
+            if (i + 1 != stackTrace.frames.size())
+                stack.append(';');
+            // Separators may not appear inside a frame.
+            stack.append(frame.toString().replace(';', ',').replace('\n', ' '));
+        }
+        String key = stack.toString();
+        auto addResult = stackCounts.add(key, 0);
+        if (addResult.isNewEntry)
+            stacks.append(key);
+        addResult.iterator->value++;
+    }
+
+    StringBuilder folded;
+    for (const String& stack : stacks) {
+        folded.append(stack);
+        folded.append(' ');
+        folded.appendNumber(stackCounts.get(stack));
+        folded.append('\n');
+    }
+
+    clearData(locker);
+
+    return folded.toString();
+}
+
 void SamplingProfiler::registerForReportAtExit()
 {
     static Lock registrationLock;
@@ -20,7 +20,7 @@ String::String(JNIEnv* env, const JLString &s)
         } else {
             const jchar* str = env->GetStringCritical(s, NULL);
             if (str) {
-                m_impl = StringImpl::create((const UChar*)str, len);
+                m_impl = StringImpl::create8BitIfPossible((const UChar*)str, len);
                 env->ReleaseStringCritical(s, str);
             } else {
                 m_impl = StringImpl::create(reinterpret_cast<const UChar*>(L"OME"), 3);
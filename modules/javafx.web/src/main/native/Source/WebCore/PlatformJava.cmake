@@ -14,6 +14,9 @@ endif ()
 list(APPEND WebCore_INCLUDE_DIRECTORIES
     "${WEBCORE_DIR}/platform/java"
     "${WEBCORE_DIR}/platform/graphics/java"
+    "${WEBCORE_DIR}/platform/image-decoders"
+    "${WEBCORE_DIR}/platform/image-decoders/bmp"
+    "${WEBCORE_DIR}/platform/image-decoders/gif"
     "${WEBCORE_DIR}/platform/linux"
     "${WEBCORE_DIR}/platform/network"
     "${WEBCORE_DIR}/platform/network/java"
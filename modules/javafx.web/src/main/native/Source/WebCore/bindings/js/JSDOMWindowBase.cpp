@@ -382,26 +382,43 @@ static bool isResponseCorrect(JSC::ExecState* exec, FetchResponse* inputResponse
     return true;
 }
 
-static void handleResponseOnStreamingAction(JSC::JSGlobalObject* globalObject, JSC::ExecState* exec, FetchResponse* inputResponse, JSC::JSPromiseDeferred* promise, Function<void(JSC::ExecState* exec, const char* data, size_t byteSize)>&& actionCallback)
+static void handleResponseOnStreamingAction(JSC::JSGlobalObject* globalObject, JSC::ExecState* exec, FetchResponse* inputResponse, JSC::JSPromiseDeferred* promise, Function<void(JSC::ExecState* exec, Vector<uint8_t>&& bytes)>&& actionCallback)
 {
     if (!isResponseCorrect(exec, inputResponse, promise))
         return;
 
     if (inputResponse->isBodyReceivedByChunk()) {
-        inputResponse->consumeBodyReceivedByChunk([promise, callback = WTFMove(actionCallback), globalObject, data = SharedBuffer::create()] (auto&& result) mutable {
+        // Chunks are appended straight into the buffer handed to the Wasm compiler,
+        // sized up front from Content-Length when the server sends one. The header
+        // is only a hint, so the reservation is capped.
+        static const uint64_t maxReservedBytes = 64 * 1024 * 1024;
+        Vector<uint8_t> bytes;
+        bool ok;
+        uint64_t contentLength = inputResponse->headers().fastGet(HTTPHeaderName::ContentLength).toUInt64Strict(&ok);
+        if (ok)
+            bytes.tryReserveCapacity(static_cast<size_t>(std::min(contentLength, maxReservedBytes)));
+
+        inputResponse->consumeBodyReceivedByChunk([promise, callback = WTFMove(actionCallback), globalObject, bytes = WTFMove(bytes), failed = false] (auto&& result) mutable {
+            if (failed)
+                return;
+
             ExecState* exec = globalObject->globalExec();
             if (result.hasException()) {
                 promise->reject(exec, createTypeError(exec, result.exception().message()));
                 return;
             }
 
-            if (auto chunk = result.returnValue())
-                data->append(reinterpret_cast<const char*>(chunk->data), chunk->size);
-            else {
+            if (auto chunk = result.returnValue()) {
+                if (!bytes.tryAppend(chunk->data, chunk->size)) {
+                    promise->reject(exec, createOutOfMemoryError(exec));
+                    bytes.clear();
+                    failed = true;
+                }
+            } else {
                 VM& vm = exec->vm();
                 JSLockHolder lock(vm);
 
-                callback(exec, data->data(), data->size());
+                callback(exec, WTFMove(bytes));
             }
         });
         return;
@@ -413,7 +430,8 @@ static void handleResponseOnStreamingAction(JSC::JSGlobalObject* globalObject, J
             VM& vm = exec->vm();
             JSLockHolder lock(vm);
 
-            actionCallback(exec, buffer->data(), buffer->size());
+            if (auto bytes = tryAllocate(exec, promise, buffer->data(), buffer->size()))
+                actionCallback(exec, WTFMove(*bytes));
             return;
         }
         // FIXME: http://webkit.org/b/184886> Implement loading for the Blob type
@@ -422,7 +440,8 @@ static void handleResponseOnStreamingAction(JSC::JSGlobalObject* globalObject, J
         VM& vm = exec->vm();
         JSLockHolder lock(vm);
 
-        actionCallback(exec, buffer->data(), buffer->size());
+        if (auto bytes = tryAllocate(exec, promise, buffer->data(), buffer->size()))
+            actionCallback(exec, WTFMove(*bytes));
     }, [&] (std::nullptr_t&) {
         promise->reject(exec, createTypeError(exec, "Unexpected Response's Content-type"_s));
     });
@@ -438,9 +457,8 @@ void JSDOMWindowBase::compileStreaming(JSC::JSGlobalObject* globalObject, JSC::E
     ASSERT(vm.promiseDeferredTimer->hasDependancyInPendingPromise(promise, globalObject));
 
     if (auto inputResponse = JSFetchResponse::toWrapped(vm, source)) {
-        handleResponseOnStreamingAction(globalObject, exec, inputResponse, promise, [promise] (JSC::ExecState* exec, const char* data, size_t byteSize) mutable {
-            if (auto arrayBuffer = tryAllocate(exec, promise, data, byteSize))
-                JSC::WebAssemblyPrototype::webAssemblyModuleValidateAsync(exec, promise, WTFMove(*arrayBuffer));
+        handleResponseOnStreamingAction(globalObject, exec, inputResponse, promise, [promise] (JSC::ExecState* exec, Vector<uint8_t>&& bytes) mutable {
+            JSC::WebAssemblyPrototype::webAssemblyModuleValidateAsync(exec, promise, WTFMove(bytes));
         });
     } else
         promise->reject(exec, createTypeError(exec, "first argument must be an Response or Promise for Response"_s));
@@ -457,9 +475,8 @@ void JSDOMWindowBase::instantiateStreaming(JSC::JSGlobalObject* globalObject, JS
     ASSERT(vm.promiseDeferredTimer->hasDependancyInPendingPromise(promise, importedObject));
 
     if (auto inputResponse = JSFetchResponse::toWrapped(vm, source)) {
-        handleResponseOnStreamingAction(globalObject, exec, inputResponse, promise, [promise, importedObject] (JSC::ExecState* exec, const char* data, size_t byteSize) mutable {
-            if (auto arrayBuffer = tryAllocate(exec, promise, data, byteSize))
-                JSC::WebAssemblyPrototype::webAssemblyModuleInstantinateAsync(exec, promise, WTFMove(*arrayBuffer), importedObject);
+        handleResponseOnStreamingAction(globalObject, exec, inputResponse, promise, [promise, importedObject] (JSC::ExecState* exec, Vector<uint8_t>&& bytes) mutable {
+            JSC::WebAssemblyPrototype::webAssemblyModuleInstantinateAsync(exec, promise, WTFMove(bytes), importedObject);
         });
     } else
         promise->reject(exec, createTypeError(exec, "first argument must be an Response or Promise for Response"_s));
@@ -46,8 +46,12 @@
 #include "runtime_root.h"
 #include <wtf/java/JavaRef.h>
 #include <wtf/text/WTFString.h>
+#include <JavaScriptCore/ArrayBuffer.h>
 #include <JavaScriptCore/JSArray.h>
+#include <JavaScriptCore/JSArrayBuffer.h>
 #include <JavaScriptCore/JSLock.h>
+#include <JavaScriptCore/TypedArrayInlines.h>
+#include <JavaScriptCore/TypedArrays.h>
 #include <JavaScriptCore/APICast.h>
 #include <JavaScriptCore/OpaqueJSString.h>
 #include <JavaScriptCore/JSBase.h>
@@ -106,6 +110,36 @@ static jclass getStringClass (JNIEnv *env)
     FIND_CACHE_CLASS(env, "java/lang/String");
 }
 
+static jclass getBufferClass (JNIEnv *env)
+{
+    FIND_CACHE_CLASS(env, "java/nio/Buffer");
+}
+
+static jclass getByteBufferClass (JNIEnv *env)
+{
+    FIND_CACHE_CLASS(env, "java/nio/ByteBuffer");
+}
+
+static jclass getShortBufferClass (JNIEnv *env)
+{
+    FIND_CACHE_CLASS(env, "java/nio/ShortBuffer");
+}
+
+static jclass getIntBufferClass (JNIEnv *env)
+{
+    FIND_CACHE_CLASS(env, "java/nio/IntBuffer");
+}
+
+static jclass getFloatBufferClass (JNIEnv *env)
+{
+    FIND_CACHE_CLASS(env, "java/nio/FloatBuffer");
+}
+
+static jclass getDoubleBufferClass (JNIEnv *env)
+{
+    FIND_CACHE_CLASS(env, "java/nio/DoubleBuffer");
+}
+
 static jclass getNullPointerExceptionClass (JNIEnv *env)
 {
     FIND_CACHE_CLASS(env, "java/lang/NullPointerException");
@@ -134,6 +168,103 @@ JSStringRef asJSStringRef(JNIEnv *env, jstring str)
     return name;
 }
 
+static bool hasNativeByteOrder(JNIEnv *env, jobject buffer)
+{
+    static JGObject nativeOrder;
+    if (!nativeOrder) {
+        JLClass byteOrderClass(env->FindClass("java/nio/ByteOrder"));
+        nativeOrder = JLObject(env->CallStaticObjectMethod(byteOrderClass,
+            env->GetStaticMethodID(byteOrderClass, "nativeOrder", "()Ljava/nio/ByteOrder;")));
+    }
+    JLObject order(JSC::Bindings::callJNIMethod<jobject>(buffer, "order", "()Ljava/nio/ByteOrder;"));
+    return env->IsSameObject(order, nativeOrder);
+}
+
+template<typename ViewType>
+static JSC::JSValue wrapTypedArray(JSC::ExecState* exec, RefPtr<JSC::ArrayBuffer>&& buffer, unsigned length)
+{
+    RefPtr<ViewType> view = ViewType::create(WTFMove(buffer), 0, length);
+    if (!view)
+        return JSC::JSValue();
+    return view->wrap(exec, exec->lexicalGlobalObject());
+}
+
+static bool s_shareDirectBuffers = false;
+
+void setShareDirectBuffers(bool share)
+{
+    s_shareDirectBuffers = share;
+}
+
+// When enabled, direct NIO buffers are exposed without copying: the ArrayBuffer
+// points at the buffer memory and keeps the buffer reachable until the ArrayBuffer
+// is destroyed. A ByteBuffer becomes an ArrayBuffer; Short, Int, Float and Double
+// buffers in native byte order become the matching typed array. The whole capacity
+// is exposed, regardless of position and limit. Read-only buffers stay Java
+// objects, since typed arrays can't prevent writes.
+static JSC::JSValue directBufferToJSValue(JNIEnv *env, JSC::ExecState* exec, jobject val)
+{
+    if (!env->IsInstanceOf(val, getBufferClass(env)))
+        return JSC::JSValue();
+    if (JSC::Bindings::callJNIMethod<jboolean>(val, "isReadOnly", "()Z"))
+        return JSC::JSValue();
+
+    void* data = env->GetDirectBufferAddress(val);
+    jlong capacity = env->GetDirectBufferCapacity(val);
+    if (!data || capacity < 0)
+        return JSC::JSValue();
+
+    enum { Byte, Short, Int, Float, Double } kind;
+    unsigned elementSize;
+    if (env->IsInstanceOf(val, getByteBufferClass(env))) {
+        kind = Byte;
+        elementSize = 1;
+    } else if (env->IsInstanceOf(val, getShortBufferClass(env))) {
+        kind = Short;
+        elementSize = sizeof(jshort);
+    } else if (env->IsInstanceOf(val, getIntBufferClass(env))) {
+        kind = Int;
+        elementSize = sizeof(jint);
+    } else if (env->IsInstanceOf(val, getFloatBufferClass(env))) {
+        kind = Float;
+        elementSize = sizeof(jfloat);
+    } else if (env->IsInstanceOf(val, getDoubleBufferClass(env))) {
+        kind = Double;
+        elementSize = sizeof(jdouble);
+    } else {
+        return JSC::JSValue();
+    }
+
+    if (kind != Byte && !hasNativeByteOrder(env, val))
+        return JSC::JSValue();
+    if (static_cast<unsigned long long>(capacity) * elementSize > std::numeric_limits<unsigned>::max())
+        return JSC::JSValue();
+
+    jobject globalBuffer = env->NewGlobalRef(val);
+    RefPtr<JSC::ArrayBuffer> buffer = JSC::ArrayBuffer::createFromBytes(data, capacity * elementSize, [globalBuffer](void*) {
+        JNIEnv* env = JavaScriptCore_GetJavaEnv();
+        if (env)
+            env->DeleteGlobalRef(globalBuffer);
+    });
+
+    unsigned length = static_cast<unsigned>(capacity);
+    switch (kind) {
+    case Byte:
+        return JSC::JSArrayBuffer::create(exec->vm(),
+            exec->lexicalGlobalObject()->arrayBufferStructure(JSC::ArrayBufferSharingMode::Default),
+            WTFMove(buffer));
+    case Short:
+        return wrapTypedArray<JSC::Int16Array>(exec, WTFMove(buffer), length);
+    case Int:
+        return wrapTypedArray<JSC::Int32Array>(exec, WTFMove(buffer), length);
+    case Float:
+        return wrapTypedArray<JSC::Float32Array>(exec, WTFMove(buffer), length);
+    case Double:
+        return wrapTypedArray<JSC::Float64Array>(exec, WTFMove(buffer), length);
+    }
+    return JSC::JSValue();
+}
+
 JSValueRef Java_Object_to_JSValue(
     JNIEnv *env,
     JSContextRef ctx,
@@ -190,6 +321,12 @@ JSValueRef Java_Object_to_JSValue(
         return JSValueMakeNumber(ctx, value);
     }
 
+    if (s_shareDirectBuffers) {
+        JSC::JSValue directBuffer = directBufferToJSValue(env, exec, val);
+        if (directBuffer)
+            return toRef(exec, directBuffer);
+    }
+
     JLObject valClass(JSC::Bindings::callJNIMethod<jobject>(val, "getClass", "()Ljava/lang/Class;"));
     if (JSC::Bindings::callJNIMethod<jboolean>(valClass, "isArray", "()Z")) {
         JLString className((jstring)JSC::Bindings::callJNIMethod<jobject>(valClass, "getName", "()Ljava/lang/String;"));
@@ -15,6 +15,8 @@ jstring JSValue_to_Java_String(JSValueRef value, JNIEnv* env, JSContextRef ctx);
 jobject JSValue_to_Java_Object(JSValueRef value, JNIEnv* env, JSContextRef ctx, JSC::Bindings::RootObject* rootPeer);
 JSValueRef Java_Object_to_JSValue(JNIEnv *env, JSContextRef ctx, JSC::Bindings::RootObject* rootObject, jobject val, jobject accessControlContext);
 JSStringRef asJSStringRef(JNIEnv *env, jstring str);
+/* Whether Java_Object_to_JSValue shares direct NIO buffers with JS as typed arrays. */
+void setShareDirectBuffers(bool);
 JSGlobalContextRef getGlobalContext(WebCore::ScriptController* sc);
 jobject executeScript(JNIEnv* env,
                       JSObjectRef object,
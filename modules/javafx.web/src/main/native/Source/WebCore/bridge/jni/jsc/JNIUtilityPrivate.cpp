@@ -34,6 +34,7 @@
 #include "runtime_object.h"
 #include "runtime_root.h"
 #include <JavaScriptCore/JSArray.h>
+#include <JavaScriptCore/JSArrayBufferView.h>
 #include <JavaScriptCore/JSLock.h>
 
 #include "JavaArrayJSC.h"
@@ -61,6 +62,58 @@ static jchar toJCharValue(const JSValue& value, ExecState* exec)
     return (jchar)value.toNumber(exec);
 }
 
+template<typename ArrayType, typename ElementType>
+static jarray copyToJArray(JNIEnv* env, ArrayType (JNIEnv::*newArray)(jsize), void (JNIEnv::*setRegion)(ArrayType, jsize, jsize, const ElementType*), const void* data, jsize length)
+{
+    ArrayType array = (env->*newArray)(length);
+    if (array && length)
+        (env->*setRegion)(array, 0, length, static_cast<const ElementType*>(data));
+    return array;
+}
+
+// Copies a typed array into a new Java array with a single region call when
+// its element type matches the target array class, e.g. Float32Array to float[].
+static jarray convertTypedArrayToJArray(VM& vm, JSArrayBufferView* view, const char* javaClassName)
+{
+    if (view->isNeutered())
+        return nullptr;
+
+    JNIEnv* env = getJNIEnv();
+    const void* data = view->vector();
+    jsize length = view->length();
+    switch (view->classInfo(vm)->typedArrayStorageType) {
+    case TypeInt8:
+    case TypeUint8:
+    case TypeUint8Clamped:
+        if (!strcmp(javaClassName, "[B"))
+            return copyToJArray(env, &JNIEnv::NewByteArray, &JNIEnv::SetByteArrayRegion, data, length);
+        break;
+    case TypeInt16:
+        if (!strcmp(javaClassName, "[S"))
+            return copyToJArray(env, &JNIEnv::NewShortArray, &JNIEnv::SetShortArrayRegion, data, length);
+        break;
+    case TypeUint16:
+        if (!strcmp(javaClassName, "[C"))
+            return copyToJArray(env, &JNIEnv::NewCharArray, &JNIEnv::SetCharArrayRegion, data, length);
+        break;
+    case TypeInt32:
+        if (!strcmp(javaClassName, "[I"))
+            return copyToJArray(env, &JNIEnv::NewIntArray, &JNIEnv::SetIntArrayRegion, data, length);
+        break;
+    case TypeFloat32:
+        if (!strcmp(javaClassName, "[F"))
+            return copyToJArray(env, &JNIEnv::NewFloatArray, &JNIEnv::SetFloatArrayRegion, data, length);
+        break;
+    case TypeFloat64:
+        if (!strcmp(javaClassName, "[D"))
+            return copyToJArray(env, &JNIEnv::NewDoubleArray, &JNIEnv::SetDoubleArrayRegion, data, length);
+        break;
+    default:
+        break;
+    }
+    return nullptr;
+}
+
 jobject convertUndefinedToJObject()
 {
     static JGObject jgoUndefined;
@@ -117,6 +170,9 @@ jvalue convertValueToJValue(ExecState* exec, RootObject* rootObject, JSValue val
                         return result;
                     }
                     result.l = array->javaArray();
+                } else if (javaType == JavaTypeArray && object->inherits(vm, JSArrayBufferView::info())) {
+                    // Input is a JavaScript typed array, copied in bulk into a new Java array
+                    result.l = convertTypedArrayToJArray(vm, jsCast<JSArrayBufferView*>(object), javaClassName);
                 } else if ((!result.l && (!strcmp(javaClassName, "java.lang.Object")))
                            || (!strcmp(javaClassName, "netscape.javascript.JSObject"))) {
                     // Wrap objects in JSObject instances.
@@ -317,19 +373,19 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     }
 
     JNIEnv* env = getJNIEnv();
-    jclass objClass = env->GetObjectClass(obj);
-    jobject rmethod = env->ToReflectedMethod(objClass, methodId, isStatic);
-    jclass utilityCls = env->FindClass("com/sun/webkit/Utilities");
-    jclass objectCls = env->FindClass("java/lang/Object");
-    jobjectArray argsArray = env->NewObjectArray(count, objectCls, NULL);
+    JLClass objClass(env->GetObjectClass(obj));
+    JLObject rmethod(env->ToReflectedMethod(objClass, methodId, isStatic));
+    static JGClass utilityCls(env->FindClass("com/sun/webkit/Utilities"));
+    static JGClass objectCls(env->FindClass("java/lang/Object"));
+    JLObjectArray argsArray(env->NewObjectArray(count, objectCls, NULL));
     for (int i = 0;  i < count; i++)
       env->SetObjectArrayElement(argsArray, i, args[i]);
-    jmethodID invokeMethod =
+    static jmethodID invokeMethod =
         env->GetStaticMethodID(utilityCls, "fwkInvokeWithContext",
                                "(Ljava/lang/reflect/Method;Ljava/lang/Object;[Ljava/lang/Object;Ljava/security/AccessControlContext;)Ljava/lang/Object;");
-    jobject r = env->CallStaticObjectMethod(utilityCls, invokeMethod,
-                                            rmethod, obj, argsArray,
-                                            accessControlContext);
+    JLObject r(env->CallStaticObjectMethod(utilityCls, invokeMethod,
+                                           (jobject)rmethod, obj, (jobjectArray)argsArray,
+                                           accessControlContext));
 
     jthrowable ex = env->ExceptionOccurred();
     env->ExceptionClear();
@@ -344,7 +400,7 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     // Since we can't convert java.lang.Character to any JS primitive, we have
     // to treat it as JS foreign object.
     case JavaTypeChar:
-        result.l = r;
+        result.l = r.releaseLocal();
         break;
 
     case JavaTypeBoolean:
@@ -382,6 +438,94 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     return ex;
 }
 
+jthrowable dispatchJNICallDirect(jobject obj, JavaType returnType, jmethodID methodId, const jvalue* args, jvalue& result)
+{
+    JNIEnv* env = getJNIEnv();
+
+    switch (returnType) {
+    case JavaTypeVoid:
+        env->CallVoidMethodA(obj, methodId, args);
+        break;
+
+    case JavaTypeArray:
+    case JavaTypeObject:
+        result.l = env->CallObjectMethodA(obj, methodId, args);
+        break;
+
+    // The caller expects a java.lang.Character object, just like the
+    // one returned by dispatchJNICall.
+    case JavaTypeChar:
+        {
+            jvalue c;
+            c.c = env->CallCharMethodA(obj, methodId, args);
+            result.l = env->ExceptionCheck() ? nullptr : jvalueToJObject(c, JavaTypeChar);
+        }
+        break;
+
+    case JavaTypeBoolean:
+        result.z = env->CallBooleanMethodA(obj, methodId, args);
+        break;
+
+    case JavaTypeByte:
+        result.b = env->CallByteMethodA(obj, methodId, args);
+        break;
+
+    case JavaTypeShort:
+        result.s = env->CallShortMethodA(obj, methodId, args);
+        break;
+
+    case JavaTypeInt:
+        result.i = env->CallIntMethodA(obj, methodId, args);
+        break;
+
+    case JavaTypeLong:
+        result.j = env->CallLongMethodA(obj, methodId, args);
+        break;
+
+    case JavaTypeFloat:
+        result.f = env->CallFloatMethodA(obj, methodId, args);
+        break;
+
+    case JavaTypeDouble:
+        result.d = env->CallDoubleMethodA(obj, methodId, args);
+        break;
+
+    case JavaTypeInvalid:
+        /* Nothing to do */
+        break;
+    }
+
+    jthrowable ex = env->ExceptionOccurred();
+    env->ExceptionClear();
+    return ex;
+}
+
+// A direct call doesn't run the method within the access control context of
+// the page, which only matters when a security manager is installed. One can
+// be installed at any time, so the JVM is asked on every call until one has
+// been seen; from then on the direct path is never taken again.
+bool isSecurityManagerInstalled()
+{
+    static bool installed = false;
+    if (installed)
+        return true;
+
+    JNIEnv* env = getJNIEnv();
+
+    static JGClass systemCls(env->FindClass("java/lang/System"));
+    static jmethodID getSecurityManagerMID = env->GetStaticMethodID(systemCls,
+        "getSecurityManager", "()Ljava/lang/SecurityManager;");
+    ASSERT(getSecurityManagerMID);
+
+    JLObject securityManager(env->CallStaticObjectMethod(systemCls, getSecurityManagerMID));
+    if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+        return true;
+    }
+    installed = !!securityManager;
+    return installed;
+}
+
 } // end of namespace Bindings
 
 } // end of namespace JSC
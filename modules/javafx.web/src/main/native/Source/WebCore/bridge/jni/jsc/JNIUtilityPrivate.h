@@ -43,6 +43,8 @@ class RootObject;
 jvalue convertValueToJValue(ExecState*, RootObject*, JSValue, JavaType, const char* javaClassName);
 jobject convertUndefinedToJObject();
 jthrowable dispatchJNICall(int, RootObject *rootObject, jobject, bool isStatic, JavaType returnType, jmethodID, jobject* args, jvalue& result, jobject accessControlContext);
+jthrowable dispatchJNICallDirect(jobject, JavaType returnType, jmethodID, const jvalue* args, jvalue& result);
+bool isSecurityManagerInstalled();
 jobject jvalueToJObject(jvalue value, JavaType);
 
 } // namespace Bindings
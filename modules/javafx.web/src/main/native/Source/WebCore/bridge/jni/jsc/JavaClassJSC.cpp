@@ -170,6 +170,12 @@ Method* JavaClass::methodNamed(PropertyName propertyName, Instance*) const
     size_t i;
     if (nameLength >= 3 && name[nameLength-1] == ')'
         && (i = name.find('(', 1)) != WTF::notFound) {
+        // Scripts tend to use the same signature over and over again,
+        // remember the result of the parameter matching below.
+        auto it = m_overloads.find(name.impl());
+        if (it != m_overloads.end())
+            return it->value;
+
         Vector<String> pnames;
         size_t pstart = i + 1;
         if (pstart < nameLength-1) {
@@ -258,6 +264,12 @@ Method* JavaClass::methodNamed(PropertyName propertyName, Instance*) const
                 }
             }
         }
+        if (!methodList)
+            return nullptr;
+        Method* method = methodList->at(0);
+        delete methodList;
+        m_overloads.set(name.impl(), method);
+        return method;
     } else {
         methodList = m_methods.get(name.impl());
     }
@@ -53,6 +53,8 @@ private:
     const char* m_name;
     mutable FieldMap m_fields;
     mutable MethodListMap m_methods;
+    // Methods resolved from explicit signatures such as "append(int)".
+    mutable HashMap<RefPtr<StringImpl>, Method*> m_overloads;
 };
 
 } // namespace Bindings
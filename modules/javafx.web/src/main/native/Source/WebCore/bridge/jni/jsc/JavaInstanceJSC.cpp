@@ -241,6 +241,23 @@ JSValue JavaInstance::getMethod(ExecState* exec, PropertyName propertyName)
     return JavaRuntimeMethod::create(exec, exec->lexicalGlobalObject(), propertyName.publicName(), method);
 }
 
+// JNI doesn't check argument types, and the conversion of JS values can yield
+// any Java object, e.g. a String for undefined or an unwrapped Java object of
+// another class. Only arguments of the declared classes may be passed to a
+// direct call; anything else goes through Method.invoke, which rejects it.
+static bool argumentsMatchParameterClasses(const JavaMethod& method, const Vector<jvalue>& arguments)
+{
+    JNIEnv* env = getJNIEnv();
+    for (int i = 0; i < method.numParameters(); i++) {
+        JavaType type = method.parameterTypeAt(i);
+        if (type != JavaTypeObject && type != JavaTypeArray)
+            continue;
+        if (arguments[i].l && !env->IsInstanceOf(arguments[i].l, method.parameterClassAt(i)))
+            return false;
+    }
+    return true;
+}
+
 JSValue JavaInstance::invokeMethod(ExecState* exec, RuntimeMethod* runtimeMethod)
 {
     VM& vm = exec->vm();
@@ -301,14 +318,12 @@ JSValue JavaInstance::invokeMethod(ExecState* exec, RuntimeMethod* runtimeMethod
         return jsUndefined();
     }
 
-    Vector<jobject> jArgs(count);
+    Vector<jvalue> jValues(count);
 
     for (int i = 0; i < count; i++) {
-        CString javaClassName = jMethod->parameterAt(i).utf8();
-        JavaType jtype = javaTypeFromClassName(javaClassName.data());
-        jvalue jarg = convertValueToJValue(exec, m_rootObject.get(),
-            exec->argument(i), jtype, javaClassName.data());
-        jArgs[i] = jvalueToJObject(jarg, jtype);
+        jValues[i] = convertValueToJValue(exec, m_rootObject.get(),
+            exec->argument(i), jMethod->parameterTypeAt(i),
+            jMethod->parameterClassNameAt(i));
         LOG(LiveConnect, "JavaInstance::invokeMethod arg[%d] = %s", i, exec->argument(i).toString(exec)->value(exec).ascii().data());
     }
 
@@ -335,13 +350,25 @@ JSValue JavaInstance::invokeMethod(ExecState* exec, RuntimeMethod* runtimeMethod
         }
 
         // const char *callingURL = 0; // FIXME, need to propagate calling URL to Java
-        jmethodID methodId = getMethodID(obj, jMethod->name().utf8().data(), jMethod->signature());
-
-        jthrowable ex = dispatchJNICall(exec->argumentCount(), rootObject,
-                                        obj, jMethod->isStatic(),
-                                        jMethod->returnType(), methodId,
-                                        jArgs.data(), result,
-                                        accessControlContext());
+        jthrowable ex;
+        if (jMethod->canInvokeDirectly() && argumentsMatchParameterClasses(*jMethod, jValues)
+            && !isSecurityManagerInstalled()) {
+            // Call the method with typed JNI calls and unboxed arguments,
+            // bypassing the reflective Utilities.fwkInvokeWithContext.
+            ex = dispatchJNICallDirect(jlinstance, jMethod->returnType(),
+                                       jMethod->methodID(), jValues.data(),
+                                       result);
+        } else {
+            Vector<jobject> jArgs(count);
+            for (int i = 0; i < count; i++)
+                jArgs[i] = jvalueToJObject(jValues[i], jMethod->parameterTypeAt(i));
+
+            ex = dispatchJNICall(exec->argumentCount(), rootObject,
+                                 obj, jMethod->isStatic(),
+                                 jMethod->returnType(), jMethod->methodID(),
+                                 jArgs.data(), result,
+                                 accessControlContext());
+        }
         if (ex != NULL) {
             JSValue exceptionDescription
               = (JavaInstance::create(ex, rootObject, accessControlContext())
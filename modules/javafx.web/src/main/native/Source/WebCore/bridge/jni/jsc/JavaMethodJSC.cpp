@@ -66,8 +66,16 @@ JavaMethod::JavaMethod(JNIEnv* env, jobject aMethod)
             if (!parameterName)
                 parameterName = env->NewStringUTF("<Unknown>");
             m_parameters.append(JavaString(env, parameterName).impl());
-            env->DeleteLocalRef(aParameter);
+            m_parameterClassNames.append(m_parameters.last().utf8());
+            m_parameterTypes.append(javaTypeFromClassName(m_parameterClassNames.last().data()));
             env->DeleteLocalRef(parameterName);
+            if (m_parameterTypes.last() == JavaTypeObject || m_parameterTypes.last() == JavaTypeArray) {
+                // Takes over the local reference.
+                m_parameterClasses.append(JGClass(static_cast<jclass>(aParameter)));
+            } else {
+                m_parameterClasses.append(JGClass());
+                env->DeleteLocalRef(aParameter);
+            }
         }
         env->DeleteLocalRef(jparameters);
     }
@@ -77,6 +85,18 @@ JavaMethod::JavaMethod(JNIEnv* env, jobject aMethod)
 
     jint modifiers = callJNIMethod<jint>(aMethod, "getModifiers", "()I");
     m_isStatic = (modifiers & 0x8) != 0;
+
+    m_methodID = env->FromReflectedMethod(aMethod);
+
+    static JGClass utilitiesClass(env->FindClass("com/sun/webkit/Utilities"));
+    static jmethodID canInvokeDirectlyMID = env->GetStaticMethodID(utilitiesClass,
+        "fwkCanInvokeDirectly", "(Ljava/lang/reflect/Method;)Z");
+    ASSERT(canInvokeDirectlyMID);
+    m_canInvokeDirectly = env->CallStaticBooleanMethod(utilitiesClass, canInvokeDirectlyMID, aMethod);
+    if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+        m_canInvokeDirectly = false;
+    }
 }
 
 JavaMethod::~JavaMethod()
@@ -111,14 +131,14 @@ const char* JavaMethod::signature() const
         StringBuilder signatureBuilder;
         signatureBuilder.append('(');
         for (unsigned int i = 0; i < m_parameters.size(); i++) {
-            CString javaClassName = parameterAt(i).utf8();
-            JavaType type = javaTypeFromClassName(javaClassName.data());
+            const char* javaClassName = parameterClassNameAt(i);
+            JavaType type = parameterTypeAt(i);
             if (type == JavaTypeArray)
-                appendClassName(signatureBuilder, javaClassName.data());
+                appendClassName(signatureBuilder, javaClassName);
             else {
                 signatureBuilder.append(signatureFromJavaType(type));
                 if (type == JavaTypeObject) {
-                    appendClassName(signatureBuilder, javaClassName.data());
+                    appendClassName(signatureBuilder, javaClassName);
                     signatureBuilder.append(';');
                 }
             }
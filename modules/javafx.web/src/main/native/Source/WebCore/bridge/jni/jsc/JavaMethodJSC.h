@@ -32,6 +32,8 @@
 #include "JavaType.h"
 
 #include "JavaStringJSC.h"
+#include <wtf/java/JavaRef.h>
+#include <wtf/text/CString.h>
 
 namespace JSC {
 
@@ -47,20 +49,34 @@ public:
     const String name() const { return m_name.impl(); }
     RuntimeType returnTypeClassName() const { return m_returnTypeClassName.utf8(); }
     const String parameterAt(int i) const { return m_parameters[i]; }
+    // The parameter types are resolved once, so that converting the
+    // arguments of a call doesn't need to parse class names again.
+    JavaType parameterTypeAt(int i) const { return m_parameterTypes[i]; }
+    const char* parameterClassNameAt(int i) const { return m_parameterClassNames[i].data(); }
+    // The class of an object or array parameter, null for primitives.
+    jclass parameterClassAt(int i) const { return m_parameterClasses[i]; }
     const char* signature() const;
     JavaType returnType() const { return m_returnType; }
     bool isStatic() const { return m_isStatic; }
+    jmethodID methodID() const { return m_methodID; }
+    // Whether the method may be called with dispatchJNICallDirect.
+    bool canInvokeDirectly() const { return m_canInvokeDirectly; }
 
     // Method implementation
     int numParameters() const { return m_parameters.size(); }
 
 private:
     Vector<WTF::String> m_parameters;
+    Vector<JavaType> m_parameterTypes;
+    Vector<CString> m_parameterClassNames;
+    Vector<JGClass> m_parameterClasses;
     JavaString m_name;
     mutable char* m_signature;
     JavaString m_returnTypeClassName;
     JavaType m_returnType;
     bool m_isStatic;
+    jmethodID m_methodID;
+    bool m_canInvokeDirectly;
 };
 
 } // namespace Bindings
@@ -82,7 +82,9 @@ private:
         const jchar* uc = getUCharactersFromJStringInEnv(e, s);
         {
             //JSLockHolder lock(WebCore::JSDOMWindowBase::commonVM());
-            m_impl = StringImpl::create(reinterpret_cast<const UChar*>(uc), size);
+            // Keep Latin-1 payloads 8-bit so that consumers such as JSON.parse
+            // can take their LChar paths without widening.
+            m_impl = StringImpl::create8BitIfPossible(reinterpret_cast<const UChar*>(uc), size);
         }
         releaseUCharactersForJStringInEnv(e, s, uc);
     }
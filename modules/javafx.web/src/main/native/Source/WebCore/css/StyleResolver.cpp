@@ -1617,6 +1617,7 @@ void StyleResolver::applyProperty(CSSPropertyID id, CSSValue* value, SelectorChe
 
     RefPtr<CSSValue> valueToApply = value;
     if (value->hasVariableReferences()) {
+        state.style()->setUsesCustomProperties();
         valueToApply = resolvedVariableValue(id, *value);
         if (!valueToApply) {
             if (CSSProperty::isInheritedProperty(id))
@@ -1695,6 +1696,7 @@ void StyleResolver::applyProperty(CSSPropertyID id, CSSValue* value, SelectorChe
         state.style()->setHasExplicitlyInheritedProperties();
 
     if (customPropertyValue) {
+        state.style()->setUsesCustomProperties();
         auto& name = customPropertyValue->name();
         auto* value = isInitial ? nullptr : isInherit ? state.parentStyle()->customProperties().get(name) : customPropertyValue;
         state.style()->setCustomPropertyValue(name, value ? makeRef(*value) : CSSCustomPropertyValue::createInvalid());
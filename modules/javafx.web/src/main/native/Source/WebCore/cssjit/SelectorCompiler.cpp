@@ -53,6 +53,7 @@
 #include <JavaScriptCore/GPRInfo.h>
 #include <JavaScriptCore/LinkBuffer.h>
 #include <JavaScriptCore/MacroAssembler.h>
+#include <JavaScriptCore/Options.h>
 #include <JavaScriptCore/VM.h>
 #include <limits>
 #include <wtf/Deque.h>
@@ -394,7 +395,9 @@ static void computeBacktrackingInformation(SelectorFragmentList& selectorFragmen
 
 SelectorCompilationStatus compileSelector(const CSSSelector* lastSelector, SelectorContext selectorContext, JSC::MacroAssemblerCodeRef<CSSSelectorPtrTag>& codeRef)
 {
-    if (!JSC::VM::canUseJIT())
+    // VM::canUseJIT() is computed when threading is initialized, which can
+    // happen before the embedder has set Options::useJIT(), so check both.
+    if (!JSC::VM::canUseJIT() || !JSC::Options::useJIT())
         return SelectorCompilationStatus::CannotCompile;
     SelectorCodeGenerator codeGenerator(lastSelector, selectorContext);
     return codeGenerator.compile(codeRef);
@@ -58,7 +58,9 @@
 #include "StyleScope.h"
 #include "StyleSheetContents.h"
 #include "SubresourceIntegrity.h"
+#include <wtf/HashMap.h>
 #include <wtf/IsoMallocInlines.h>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/Ref.h>
 #include <wtf/SetForScope.h>
 #include <wtf/StdLibExtras.h>
@@ -69,6 +71,49 @@ WTF_MAKE_ISO_ALLOCATED_IMPL(HTMLLinkElement);
 
 using namespace HTMLNames;
 
+// Parsed stylesheets shared between all documents in the process. The parsed sheet kept by a
+// CachedCSSStyleSheet is dropped when the memory cache prunes decoded data or evicts the resource,
+// so documents and pages loading the same stylesheet later would otherwise have to parse it again.
+using LinkedStyleSheetCacheKey = std::pair<String, CSSParserContext>;
+using LinkedStyleSheetCache = HashMap<LinkedStyleSheetCacheKey, RefPtr<StyleSheetContents>>;
+
+static LinkedStyleSheetCache& linkedStyleSheetCache()
+{
+    static NeverDestroyed<LinkedStyleSheetCache> cache;
+    return cache;
+}
+
+static std::optional<LinkedStyleSheetCacheKey> makeLinkedStyleSheetCacheKey(const CachedCSSStyleSheet& cachedStyleSheet, const CSSParserContext& parserContext, const SecurityOrigin& securityOrigin)
+{
+    // Use the same MIME type check as StyleSheetContents::parseAuthorStyleSheet() so that equal keys parse to equal sheets.
+    bool isSameOriginRequest = securityOrigin.canRequest(parserContext.baseURL);
+    auto mimeTypeCheckHint = isStrictParserMode(parserContext.mode) || !isSameOriginRequest ? CachedCSSStyleSheet::MIMETypeCheckHint::Strict : CachedCSSStyleSheet::MIMETypeCheckHint::Lax;
+    String sheetText = cachedStyleSheet.sheetText(mimeTypeCheckHint);
+    if (sheetText.isEmpty())
+        return { };
+
+    return std::make_pair(sheetText, parserContext);
+}
+
+static void addToLinkedStyleSheetCache(LinkedStyleSheetCacheKey&& cacheKey, StyleSheetContents& contents)
+{
+    ASSERT(contents.isCacheable());
+    auto result = linkedStyleSheetCache().add(WTFMove(cacheKey), &contents);
+    if (!result.isNewEntry)
+        return;
+    contents.addedToMemoryCache();
+
+    // Prevent pathological growth.
+    const size_t maximumLinkedStyleSheetCacheSize = 20;
+    if (linkedStyleSheetCache().size() > maximumLinkedStyleSheetCacheSize) {
+        auto first = linkedStyleSheetCache().begin();
+        if (first == result.iterator)
+            ++first;
+        first->value->removedFromMemoryCache();
+        linkedStyleSheetCache().remove(first);
+    }
+}
+
 static LinkEventSender& linkLoadEventSender()
 {
     static NeverDestroyed<LinkEventSender> sharedLoadEventSender(eventNames().loadEvent);
@@ -437,6 +482,27 @@ void HTMLLinkElement::setCSSStyleSheet(const String& href, const URL& baseURL, c
         return;
     }
 
+    auto cacheKey = makeLinkedStyleSheetCacheKey(*cachedStyleSheet, parserContext, document().securityOrigin());
+    if (cacheKey) {
+        auto iterator = linkedStyleSheetCache().find(*cacheKey);
+        if (iterator != linkedStyleSheetCache().end()) {
+            Ref<StyleSheetContents> sharedSheet = *iterator->value;
+            if (sharedSheet->originalURL() == href && sharedSheet->subresourcesAllowReuse(cachePolicy, frame->loader())) {
+                ASSERT(sharedSheet->isCacheable());
+                ASSERT(!sharedSheet->isLoading());
+                initializeStyleSheet(sharedSheet.copyRef(), *cachedStyleSheet, MediaQueryParserContext(document()));
+                const_cast<CachedCSSStyleSheet*>(cachedStyleSheet)->saveParsedStyleSheet(WTFMove(sharedSheet));
+
+                m_loading = false;
+                sheetLoaded();
+                notifyLoadedSheetAndAllCriticalSubresources(false);
+                return;
+            }
+            iterator->value->removedFromMemoryCache();
+            linkedStyleSheetCache().remove(iterator);
+        }
+    }
+
     auto styleSheet = StyleSheetContents::create(href, parserContext);
     initializeStyleSheet(styleSheet.copyRef(), *cachedStyleSheet, MediaQueryParserContext(document()));
 
@@ -446,8 +512,18 @@ void HTMLLinkElement::setCSSStyleSheet(const String& href, const URL& baseURL, c
     styleSheet.get().notifyLoadedSheet(cachedStyleSheet);
     styleSheet.get().checkLoaded();
 
-    if (styleSheet.get().isCacheable())
+    if (styleSheet.get().isCacheable()) {
+        if (cacheKey)
+            addToLinkedStyleSheetCache(WTFMove(*cacheKey), styleSheet.get());
         const_cast<CachedCSSStyleSheet*>(cachedStyleSheet)->saveParsedStyleSheet(WTFMove(styleSheet));
+    }
+}
+
+void HTMLLinkElement::clearStyleSheetCache()
+{
+    for (auto& contents : linkedStyleSheetCache().values())
+        contents->removedFromMemoryCache();
+    linkedStyleSheetCache().clear();
 }
 
 bool HTMLLinkElement::styleSheetIsLoading() const
@@ -72,6 +72,7 @@ public:
 
     void dispatchPendingEvent(LinkEventSender*);
     static void dispatchPendingLoadEvents();
+    static void clearStyleSheetCache();
 
     WEBCORE_EXPORT DOMTokenList& relList();
 
@@ -59,10 +59,11 @@ StringView CachedScript::script()
     if (!m_data)
         return { };
 
+    bool isScanned = !m_scannedDataIsASCII || m_scannedSize == m_data->size();
     if (m_decodingState == NeverDecoded
         && TextEncoding(encoding()).isByteBasedEncoding()
         && m_data->size()
-        && charactersAreAllASCII(reinterpret_cast<const LChar*>(m_data->data()), m_data->size())) {
+        && (isScanned ? m_scannedDataIsASCII : charactersAreAllASCII(reinterpret_cast<const LChar*>(m_data->data()), m_data->size()))) {
 
         m_decodingState = DataAndDecodedStringHaveSameBytes;
 
@@ -70,7 +71,10 @@ StringView CachedScript::script()
         setDecodedSize(0);
         m_decodedDataDeletionTimer.stop();
 
-        m_scriptHash = StringHasher::computeHashAndMaskTop8Bits(reinterpret_cast<const LChar*>(m_data->data()), m_data->size());
+        if (isScanned)
+            m_scriptHash = m_scannedDataHasher.hashWithTop8BitsMasked();
+        else
+            m_scriptHash = StringHasher::computeHashAndMaskTop8Bits(reinterpret_cast<const LChar*>(m_data->data()), m_data->size());
     }
 
     if (m_decodingState == DataAndDecodedStringHaveSameBytes)
@@ -96,6 +100,30 @@ unsigned CachedScript::scriptHash()
     return m_scriptHash;
 }
 
+void CachedScript::updateBuffer(SharedBuffer& data)
+{
+    if (data.size() < m_scannedSize) {
+        m_scannedSize = 0;
+        m_scannedDataIsASCII = true;
+        m_scannedDataHasher = StringHasher();
+    }
+
+    // Scan the new segments as they arrive rather than the whole script
+    // at once when it is about to be executed.
+    while (m_scannedDataIsASCII && m_scannedSize < data.size()) {
+        auto segment = data.getSomeData(m_scannedSize);
+        auto* characters = reinterpret_cast<const LChar*>(segment.data());
+        if (!charactersAreAllASCII(characters, segment.size())) {
+            m_scannedDataIsASCII = false;
+            break;
+        }
+        m_scannedDataHasher.addCharacters(characters, segment.size());
+        m_scannedSize += segment.size();
+    }
+
+    CachedResource::updateBuffer(data);
+}
+
 void CachedScript::finishLoading(SharedBuffer* data)
 {
     m_data = data;
@@ -119,6 +147,9 @@ void CachedScript::setBodyDataFrom(const CachedResource& resource)
     m_script = script.m_script;
     m_scriptHash = script.m_scriptHash;
     m_decodingState = script.m_decodingState;
+    m_scannedSize = script.m_scannedSize;
+    m_scannedDataIsASCII = script.m_scannedDataIsASCII;
+    m_scannedDataHasher = script.m_scannedDataHasher;
     m_decoder = script.m_decoder;
 }
 
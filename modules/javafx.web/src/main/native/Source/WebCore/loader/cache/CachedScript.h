@@ -26,6 +26,7 @@
 #pragma once
 
 #include "CachedResource.h"
+#include <wtf/text/StringHasher.h>
 
 namespace WebCore {
 
@@ -47,6 +48,7 @@ private:
     void setEncoding(const String&) final;
     String encoding() const final;
     const TextResourceDecoder* textResourceDecoder() const final { return m_decoder.get(); }
+    void updateBuffer(SharedBuffer&) final;
     void finishLoading(SharedBuffer*) final;
 
     void destroyDecodedData() final;
@@ -59,6 +61,12 @@ private:
     enum DecodingState { NeverDecoded, DataAndDecodedStringHaveSameBytes, DataAndDecodedStringHaveDifferentBytes };
     DecodingState m_decodingState { NeverDecoded };
 
+    // The data received so far is checked for being all ASCII and hashed
+    // while it is loading, so that script() doesn't have to scan it again.
+    size_t m_scannedSize { 0 };
+    bool m_scannedDataIsASCII { true };
+    StringHasher m_scannedDataHasher;
+
     RefPtr<TextResourceDecoder> m_decoder;
 };
 
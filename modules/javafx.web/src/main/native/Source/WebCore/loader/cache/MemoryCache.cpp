@@ -304,7 +304,7 @@ void MemoryCache::pruneLiveResourcesToSize(unsigned targetSize, bool shouldDestr
     if (!currentTime) // In case prune is called directly, outside of a Frame paint.
         currentTime = MonotonicTime::now();
 
-    // Destroy any decoded data in live objects that we can.
+    // Collect the live objects whose decoded data we can destroy.
     // Start from the head, since this is the least recently accessed of the objects.
 
     // The list might not be sorted by the m_lastDecodedAccessTime. The impact
@@ -312,33 +312,53 @@ void MemoryCache::pruneLiveResourcesToSize(unsigned targetSize, bool shouldDestr
     // elapsedTime will evaluate to false as the currentTime will be a lot
     // greater than the current->m_lastDecodedAccessTime.
     // For more details see: https://bugs.webkit.org/show_bug.cgi?id=30209
-    auto it = m_liveDecodedResources.begin();
-    while (it != m_liveDecodedResources.end()) {
-        auto* current = *it;
-
-        // Increment the iterator now because the call to destroyDecodedData() below
-        // may cause a call to ListHashSet::remove() and invalidate the current
-        // iterator. Note that this is safe because unlike iteration of most
-        // WTF Hash data structures, iteration is guaranteed safe against mutation
-        // of the ListHashSet, except for removal of the item currently pointed to
-        // by a given iterator.
-        ++it;
-
+    Vector<CachedResource*> candidates;
+    for (auto* current : m_liveDecodedResources) {
         ASSERT(current->hasClients());
-        if (current->isLoaded() && current->decodedSize()) {
-            // Check to see if the remaining resources are too new to prune.
-            Seconds elapsedTime = currentTime - current->m_lastDecodedAccessTime;
-            if (!shouldDestroyDecodedDataForAllLiveResources && elapsedTime < cMinDelayBeforeLiveDecodedPrune)
-                return;
-
-            // Destroy our decoded data. This will remove us from m_liveDecodedResources, and possibly move us
-            // to a different LRU list in m_allResources.
-            current->destroyDecodedData();
-
-            if (targetSize && m_liveSize <= targetSize)
-                return;
-        }
+        if (!current->isLoaded() || !current->decodedSize())
+            continue;
+
+        // Check to see if the remaining resources are too new to prune.
+        Seconds elapsedTime = currentTime - current->m_lastDecodedAccessTime;
+        if (!shouldDestroyDecodedDataForAllLiveResources && elapsedTime < cMinDelayBeforeLiveDecodedPrune)
+            break;
+
+        candidates.append(current);
     }
+
+    // Decoding again costs about the same per byte of decoded data, e.g. per pixel of an image, whatever
+    // the resource. Destroying the largest decoded data first reaches the target by decoding the fewest
+    // resources again. Equal sizes keep their LRU order.
+    std::stable_sort(candidates.begin(), candidates.end(), [](CachedResource* a, CachedResource* b) {
+        return a->decodedSize() > b->decodedSize();
+    });
+
+    for (auto* current : candidates) {
+        // Destroying decoded data may have dropped other resources from the list already.
+        if (!m_liveDecodedResources.contains(current) || !current->decodedSize())
+            continue;
+
+        // Destroy our decoded data. This will remove us from m_liveDecodedResources, and possibly move us
+        // to a different LRU list in m_allResources.
+        destroyDecodedDataForPruning(*current);
+
+        if (targetSize && m_liveSize <= targetSize)
+            return;
+    }
+}
+
+void MemoryCache::destroyDecodedDataForPruning(CachedResource& resource)
+{
+    unsigned decodedSize = resource.decodedSize();
+    resource.destroyDecodedData();
+    if (decodedSize > resource.decodedSize())
+        m_counters.destroyedDecodedBytes += decodedSize - resource.decodedSize();
+}
+
+void MemoryCache::removeForPruning(CachedResource& resource)
+{
+    m_counters.evictedBytes += resource.size();
+    remove(resource);
 }
 
 void MemoryCache::pruneDeadResources()
@@ -376,7 +396,7 @@ void MemoryCache::pruneDeadResourcesToSize(unsigned targetSize)
                 // Destroy our decoded data. This will remove us from
                 // m_liveDecodedResources, and possibly move us to a different
                 // LRU list in m_allResources.
-                resource->destroyDecodedData();
+                destroyDecodedDataForPruning(*resource);
 
                 if (targetSize && m_deadSize <= targetSize)
                     return;
@@ -390,7 +410,7 @@ void MemoryCache::pruneDeadResourcesToSize(unsigned targetSize)
                 continue;
 
             if (!resource->hasClients() && !resource->isPreloaded() && !resource->isCacheValidator()) {
-                remove(*resource);
+                removeForPruning(*resource);
                 if (targetSize && m_deadSize <= targetSize)
                     return;
             }
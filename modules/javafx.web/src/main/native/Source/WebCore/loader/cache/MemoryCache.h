@@ -90,6 +90,15 @@ public:
         TypeStatistic fonts;
     };
 
+    // Running totals since the process started.
+    struct Counters {
+        uint64_t hits { 0 }; // Requests served from the cache without revalidation.
+        uint64_t revalidations { 0 };
+        uint64_t misses { 0 };
+        uint64_t evictedBytes { 0 }; // Size of the resources removed from the cache by pruning.
+        uint64_t destroyedDecodedBytes { 0 }; // Decoded data dropped by pruning, to be decoded again on next use.
+    };
+
     WEBCORE_EXPORT static MemoryCache& singleton();
 
     WEBCORE_EXPORT CachedResource* resourceForRequest(const ResourceRequest&, PAL::SessionID);
@@ -148,6 +157,11 @@ public:
     // Function to collect cache statistics for the caches window in the Safari Debug menu.
     WEBCORE_EXPORT Statistics getStatistics();
 
+    const Counters& counters() const { return m_counters; }
+    void countHit() { ++m_counters.hits; }
+    void countRevalidation() { ++m_counters.revalidations; }
+    void countMiss() { ++m_counters.misses; }
+
     void resourceAccessed(CachedResource&);
     bool inLiveDecodedResourcesList(CachedResource& resource) const { return m_liveDecodedResources.contains(&resource); }
 
@@ -184,6 +198,9 @@ private:
     unsigned deadCapacity() const;
     bool needsPruning() const;
 
+    void destroyDecodedDataForPruning(CachedResource&);
+    void removeForPruning(CachedResource&);
+
     CachedResource* resourceForRequestImpl(const ResourceRequest&, CachedResourceMap&);
 
     CachedResourceMap& ensureSessionResourceMap(PAL::SessionID);
@@ -200,6 +217,8 @@ private:
     unsigned m_liveSize { 0 }; // The number of bytes currently consumed by "live" resources in the cache.
     unsigned m_deadSize { 0 }; // The number of bytes currently consumed by "dead" resources in the cache.
 
+    Counters m_counters;
+
     // Size-adjusted and popularity-aware LRU list collection for cache objects.  This collection can hold
     // more resources than the cached resource map, since it can also hold "stale" multiple versions of objects that are
     // waiting to die when the clients referencing them go away.
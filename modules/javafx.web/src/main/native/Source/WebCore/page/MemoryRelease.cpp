@@ -35,6 +35,7 @@
 #include "FontCache.h"
 #include "Frame.h"
 #include "GCController.h"
+#include "HTMLLinkElement.h"
 #include "HTMLMediaElement.h"
 #include "InlineStyleSheetOwner.h"
 #include "InspectorInstrumentation.h"
@@ -73,6 +74,7 @@ static void releaseNoncriticalMemory()
     MemoryCache::singleton().pruneDeadResourcesToSize(0);
 
     InlineStyleSheetOwner::clearCache();
+    HTMLLinkElement::clearStyleSheetCache();
 }
 
 static void releaseCriticalMemory(Synchronous synchronous)
@@ -32,6 +32,7 @@
 #include "ImageDecoderDirect2D.h"
 #elif PLATFORM(JAVA)
 #include "ImageDecoderJava.h"
+#include "ScalableImageDecoder.h"
 #else
 #include "ScalableImageDecoder.h"
 #endif
@@ -56,6 +57,14 @@ RefPtr<ImageDecoder> ImageDecoder::create(SharedBuffer& data, const String& mime
 #elif USE(DIRECT2D)
     return ImageDecoderDirect2D::create(data, alphaOption, gammaAndColorProfileOption);
 #elif PLATFORM(JAVA)
+    if (ImageDecoderJava::useNativeDecoders()) {
+        if (auto decoder = ScalableImageDecoder::create(data, alphaOption, gammaAndColorProfileOption))
+            return decoder;
+        // Not enough data to sniff the signature yet; ImageSource retries
+        // once more data arrives.
+        if (data.size() < ScalableImageDecoder::lengthOfLongestSignature)
+            return nullptr;
+    }
     return ImageDecoderJava::create(data, alphaOption, gammaAndColorProfileOption);
 #else
     return ScalableImageDecoder::create(data, alphaOption, gammaAndColorProfileOption);
@@ -66,6 +66,7 @@ typedef WebCore::PlatformPath PlatformPath;
 
 #elif PLATFORM(JAVA)
 #include <wtf/RefPtr.h>
+#include <wtf/Vector.h>
 #include "RQRef.h"
 typedef RefPtr<WebCore::RQRef> PlatformPath;
 
@@ -180,6 +181,9 @@ namespace WebCore {
         // meaning Path::platformPath() can return null.
 #if USE(DIRECT2D)
         PlatformPathPtr platformPath() const { return m_path.get(); }
+#elif PLATFORM(JAVA)
+        // Transfers the pending segments to the Java path before returning it.
+        PlatformPathPtr platformPath() const;
 #else
         PlatformPathPtr platformPath() const { return m_path; }
 #endif
@@ -222,6 +226,24 @@ namespace WebCore {
         COMPtr<ID2D1GeometrySink> m_activePath;
 #else
         PlatformPathPtr m_path { nullptr };
+#endif
+#if PLATFORM(JAVA)
+        void flushSegments() const;
+        bool hasNativeSegmentsOnly() const;
+        bool hasNativeLineSegmentsOnly() const;
+
+        // Move/line/curve/close segments are recorded natively and transferred
+        // to the Java path in bulk by flushSegments(). The segments are kept
+        // natively after the transfer so that the queries on the paths built
+        // of them don't need the Java path.
+        mutable Vector<jint> m_segmentTypes;
+        mutable Vector<jfloat> m_segmentCoords;
+        mutable size_t m_flushedTypeCount { 0 };
+        mutable size_t m_flushedCoordCount { 0 };
+        // The Java path has segments not recorded natively (e.g. arcs).
+        bool m_hasJavaOnlySegments { false };
+        bool m_hasCurveSegments { false };
+        bool m_hasCurrentPoint { false };
 #endif
     };
 
@@ -30,6 +30,13 @@
 
 namespace WebCore {
 
+static Seconds s_refreshInterval = 1_s / 60;
+
+void DisplayRefreshMonitorJava::setRefreshInterval(Seconds interval)
+{
+    s_refreshInterval = interval;
+}
+
 DisplayRefreshMonitorJava::DisplayRefreshMonitorJava(PlatformDisplayID displayID)
     : DisplayRefreshMonitor(displayID)
     , m_pulseTimer(*this, &DisplayRefreshMonitorJava::displayLinkFired)
@@ -45,8 +52,11 @@ bool DisplayRefreshMonitorJava::requestRefreshCallback()
     if (!isActive() || m_pulseTimer.isActive())
         return false;
 
-    // start pulse timer to get callback as soon as possible
-    m_pulseTimer.startOneShot(0_s);
+    // Start pulse timer to get callback at the next refresh interval
+    // boundary, so that back to back requestAnimationFrame callbacks
+    // can't run more often than frames are presented.
+    Seconds delay = m_lastFireTime + s_refreshInterval - MonotonicTime::now();
+    m_pulseTimer.startOneShot(std::max(delay, 0_s));
 
     LockHolder lock(mutex());
     setIsScheduled(true);
@@ -63,6 +73,7 @@ void DisplayRefreshMonitorJava::displayLinkFired()
         setIsPreviousFrameDone(false);
     }
     ASSERT(isMainThread());
+    m_lastFireTime = MonotonicTime::now();
     handleDisplayRefreshedNotificationOnMainThread(this);
 }
 
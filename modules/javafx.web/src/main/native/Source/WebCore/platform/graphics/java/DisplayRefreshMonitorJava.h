@@ -29,6 +29,7 @@
 
 #include "DisplayRefreshMonitor.h"
 #include "Timer.h"
+#include <wtf/MonotonicTime.h>
 
 namespace WebCore {
 
@@ -44,9 +45,14 @@ public:
     void displayLinkFired() override;
     bool requestRefreshCallback() override;
 
+    // The minimum interval between two refresh callbacks, normally the
+    // period of the FX pulse.
+    static void setRefreshInterval(Seconds);
+
 private:
     explicit DisplayRefreshMonitorJava(PlatformDisplayID);
     Timer m_pulseTimer;
+    MonotonicTime m_lastFireTime;
 };
 
 } // namespace WebCore
@@ -44,63 +44,24 @@ void FontCascade::drawGlyphs(GraphicsContext& gc,
                       const FloatPoint& point,
                       FontSmoothingMode)
 {
-    // we need to call freeSpace() before refIntArr() and refFloatArr(), see RT-19695.
-    RenderingQueue& rq = gc.platformContext()->rq().freeSpace(24);
-
-    JNIEnv* env = WebCore_GetJavaEnv();
-
-    //prepare Glyphs array
-    JLocalRef<jintArray> jGlyphs(env->NewIntArray(numGlyphs));
-    ASSERT(jGlyphs);
-    {
-        jint *bufArray = (jint*)env->GetPrimitiveArrayCritical(jGlyphs, NULL);
-        ASSERT(bufArray);
-        memcpy(bufArray, glyphBuffer.glyphs(from), sizeof(jint)*numGlyphs);
-        env->ReleasePrimitiveArrayCritical(jGlyphs, bufArray, 0);
-    }
-    static jmethodID refIntArr_mID = env->GetMethodID(
-        PG_GetRenderQueueClass(env),
-        "refIntArr",
-        "([I)I");
-    ASSERT(refIntArr_mID);
-    jint sid = env->CallIntMethod(
-        rq.getWCRenderingQueue(),
-        refIntArr_mID,
-        (jintArray)jGlyphs);
-    CheckAndClearException(env);
-
-
-    // Prepare Offsets/Advances array
-    JLocalRef<jfloatArray> jAdvance(env->NewFloatArray(numGlyphs));
-    CheckAndClearException(env);
-    ASSERT(jAdvance);
-    {
-        jfloat *bufArray = env->GetFloatArrayElements(jAdvance, NULL);
-        ASSERT(bufArray);
-        for (unsigned i = 0; i < numGlyphs; ++i) {
-            auto pAdvance = glyphBuffer.advances(from + i);
-            if (!pAdvance)
-                continue;
-            bufArray[i] = jfloat(pAdvance->width());
-        }
-        env->ReleaseFloatArrayElements(jAdvance, bufArray, 0);
-    }
-    static jmethodID refFloatArr_mID = env->GetMethodID(
-        PG_GetRenderQueueClass(env),
-        "refFloatArr",
-        "([F)I");
-    ASSERT(refFloatArr_mID);
-    jint aid = env->CallIntMethod(
-        rq.getWCRenderingQueue(),
-        refFloatArr_mID,
-        (jfloatArray)jAdvance);
-    CheckAndClearException(env);
+    // The glyphs and their advances are written into the queue itself,
+    // which saves creating two Java arrays per glyph run.
+    RenderingQueue& rq = gc.platformContext()->rq().freeSpace(
+        24 + 2 * sizeof(jint) * numGlyphs);
 
     rq  << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWSTRING_FAST
         << font.platformData().nativeFontData()
-        << sid
-        << aid
-        << (jfloat)point.x()
+        << (jint)numGlyphs;
+    const GlyphBufferGlyph* glyphs = glyphBuffer.glyphs(from);
+    for (unsigned i = 0; i < numGlyphs; ++i)
+        rq << (jint)glyphs[i];
+
+    rq  << (jint)numGlyphs;
+    const GlyphBufferAdvance* advances = glyphBuffer.advances(from);
+    for (unsigned i = 0; i < numGlyphs; ++i)
+        rq << (jfloat)advances[i].width();
+
+    rq  << (jfloat)point.x()
         << (jfloat)point.y();
 }
 
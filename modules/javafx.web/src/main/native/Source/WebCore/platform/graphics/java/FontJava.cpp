@@ -122,6 +122,11 @@ RefPtr<Font> Font::platformCreateScaledFont(const FontDescription&, float scaleF
     return Font::create(*m_platformData.derive(scaleFactor), origin(), Interstitial::No);
 }
 
+// Glyph widths are fetched from Java for a whole block of consecutive
+// glyphs at once, so that measuring text doesn't cost a JNI round-trip
+// per glyph. Glyphs used by a run of text tend to be close to each other.
+static const Glyph glyphWidthBlockSize = 64;
+
 float Font::platformWidthForGlyph(Glyph c) const
 {
     JNIEnv* env = WebCore_GetJavaEnv();
@@ -130,12 +135,26 @@ float Font::platformWidthForGlyph(Glyph c) const
     if (!jFont)
         return 0.0f;
 
-    static jmethodID getGlyphWidth_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getGlyphWidth", "(I)D");
-    ASSERT(getGlyphWidth_mID);
+    static jmethodID getGlyphWidths_mID = env->GetMethodID(PG_GetFontClass(env),
+        "getGlyphWidths", "(II)[F");
+    ASSERT(getGlyphWidths_mID);
 
-    float res = env->CallDoubleMethod(*jFont, getGlyphWidth_mID, (jint)c);
-    CheckAndClearException(env);
+    Glyph firstGlyph = c - c % glyphWidthBlockSize;
+    JLocalRef<jfloatArray> jWidths((jfloatArray)env->CallObjectMethod(*jFont,
+        getGlyphWidths_mID, (jint)firstGlyph, (jint)glyphWidthBlockSize));
+    if (CheckAndClearException(env) || !jWidths)
+        return 0.0f;
+
+    float res = 0.0f;
+    jfloat* widths = env->GetFloatArrayElements(jWidths, nullptr);
+    for (Glyph i = 0; i < glyphWidthBlockSize; ++i) {
+        Glyph glyph = firstGlyph + i;
+        if (glyph == c)
+            res = widths[i];
+        else if (m_glyphToWidthMap.metricsForGlyph(glyph) == cGlyphSizeUnknown)
+            m_glyphToWidthMap.setMetricsForGlyph(glyph, widths[i]);
+    }
+    env->ReleaseFloatArrayElements(jWidths, widths, JNI_ABORT);
 
     return res;
 }
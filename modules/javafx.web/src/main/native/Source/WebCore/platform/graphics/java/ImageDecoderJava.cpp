@@ -52,6 +52,8 @@ namespace WebCore {
   static ImageDecoderCounter sourceCounter;
 #endif
 
+bool ImageDecoderJava::s_useNativeDecoders = false;
+
 ImageDecoderJava::ImageDecoderJava()
 {
 #ifndef NDEBUG
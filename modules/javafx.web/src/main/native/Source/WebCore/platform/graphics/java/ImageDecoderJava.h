@@ -44,6 +44,11 @@ public:
 
     static bool supportsMediaType(MediaType type) { return type == MediaType::Image; }
 
+    // When enabled, formats with a native decoder (GIF, BMP) bypass
+    // WCImageDecoder and are decoded by ScalableImageDecoder instead.
+    static bool useNativeDecoders() { return s_useNativeDecoders; }
+    static void setUseNativeDecoders(bool useNativeDecoders) { s_useNativeDecoders = useNativeDecoders; }
+
     static Ref<ImageDecoder> create(const SharedBuffer&, AlphaOption, GammaAndColorProfileOption)
     {
         return adoptRef(*new ImageDecoderJava());
@@ -86,6 +91,9 @@ protected:
     // Native Handle for Java object.
     JGObject m_nativeDecoder;
     mutable IntSize m_size;
+
+private:
+    static bool s_useNativeDecoders;
 };
 
 } // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 #include "config.h"
 
 #include "Path.h"
+#include "AffineTransform.h"
 #include "FloatRect.h"
 #include "StrokeStyleApplier.h"
 #include <wtf/java/JavaEnv.h>
@@ -89,6 +90,13 @@ Path::Path()
 
 Path::Path(const Path& p)
     : m_path(copyPath(p.platformPath()))
+    , m_segmentTypes(p.m_segmentTypes)
+    , m_segmentCoords(p.m_segmentCoords)
+    , m_flushedTypeCount(p.m_segmentTypes.size())
+    , m_flushedCoordCount(p.m_segmentCoords.size())
+    , m_hasJavaOnlySegments(p.m_hasJavaOnlySegments)
+    , m_hasCurveSegments(p.m_hasCurveSegments)
+    , m_hasCurrentPoint(p.m_hasCurrentPoint)
 {}
 
 Path::~Path()
@@ -96,14 +104,20 @@ Path::~Path()
 
 Path::Path(Path&& other)
 {
-    m_path = other.m_path;
-    other.m_path = nullptr;
+    *this = WTFMove(other);
 }
 
 Path& Path::operator=(const Path &p)
 {
     if (this != &p) {
         m_path = copyPath(p.platformPath());
+        m_segmentTypes = p.m_segmentTypes;
+        m_segmentCoords = p.m_segmentCoords;
+        m_flushedTypeCount = m_segmentTypes.size();
+        m_flushedCoordCount = m_segmentCoords.size();
+        m_hasJavaOnlySegments = p.m_hasJavaOnlySegments;
+        m_hasCurveSegments = p.m_hasCurveSegments;
+        m_hasCurrentPoint = p.m_hasCurrentPoint;
     }
     return *this;
 }
@@ -115,13 +129,163 @@ Path& Path::operator=(Path&& other)
 
     m_path = other.m_path;
     other.m_path = nullptr;
+    m_segmentTypes = WTFMove(other.m_segmentTypes);
+    m_segmentCoords = WTFMove(other.m_segmentCoords);
+    m_flushedTypeCount = std::exchange(other.m_flushedTypeCount, 0);
+    m_flushedCoordCount = std::exchange(other.m_flushedCoordCount, 0);
+    m_hasJavaOnlySegments = std::exchange(other.m_hasJavaOnlySegments, false);
+    m_hasCurveSegments = std::exchange(other.m_hasCurveSegments, false);
+    m_hasCurrentPoint = std::exchange(other.m_hasCurrentPoint, false);
     return *this;
 }
 
+PlatformPathPtr Path::platformPath() const
+{
+    flushSegments();
+    return m_path;
+}
+
+void Path::flushSegments() const
+{
+    if (m_flushedTypeCount == m_segmentTypes.size()) {
+        return;
+    }
+    ASSERT(m_path);
+
+    JNIEnv* env = WebCore_GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addSegments",
+        "([I[F)V");
+    ASSERT(mid);
+
+    jsize typeCount = m_segmentTypes.size() - m_flushedTypeCount;
+    jsize coordCount = m_segmentCoords.size() - m_flushedCoordCount;
+
+    JLocalRef<jintArray> types(env->NewIntArray(typeCount));
+    env->SetIntArrayRegion(types, 0, typeCount,
+        m_segmentTypes.data() + m_flushedTypeCount);
+    JLocalRef<jfloatArray> coords(env->NewFloatArray(coordCount));
+    env->SetFloatArrayRegion(coords, 0, coordCount,
+        m_segmentCoords.data() + m_flushedCoordCount);
+
+    env->CallVoidMethod(*m_path, mid, (jintArray)types, (jfloatArray)coords);
+    CheckAndClearException(env);
+
+    m_flushedTypeCount = m_segmentTypes.size();
+    m_flushedCoordCount = m_segmentCoords.size();
+}
+
+/*
+ * Whether the queries may be answered by the natively recorded segments.
+ * A path that doesn't start with a move is left to the Java side, which
+ * drops the segments preceding the initial move.
+ */
+bool Path::hasNativeSegmentsOnly() const
+{
+    return !m_hasJavaOnlySegments
+        && (m_segmentTypes.isEmpty() || m_segmentTypes[0] == com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO);
+}
+
+bool Path::hasNativeLineSegmentsOnly() const
+{
+    return !m_hasCurveSegments && hasNativeSegmentsOnly();
+}
+
+/*
+ * Calls the function for each of the natively recorded segments the way
+ * the Java path would store them: a move followed by another move and
+ * repeated closes are dropped.
+ */
+template<typename Function>
+static void forEachSegment(const Vector<jint>& types, const Vector<jfloat>& coords, const Function& function)
+{
+    size_t ci = 0;
+    for (size_t i = 0; i < types.size(); ++i) {
+        jint type = types[i];
+        size_t count = 0;
+        switch (type) {
+        case com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO:
+        case com_sun_webkit_graphics_WCPathIterator_SEG_LINETO:
+            count = 2;
+            break;
+        case com_sun_webkit_graphics_WCPathIterator_SEG_QUADTO:
+            count = 4;
+            break;
+        case com_sun_webkit_graphics_WCPathIterator_SEG_CUBICTO:
+            count = 6;
+            break;
+        }
+        bool skip = (type == com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO
+                && i + 1 < types.size() && types[i + 1] == com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO)
+            || (type == com_sun_webkit_graphics_WCPathIterator_SEG_CLOSE
+                && i > 0 && types[i - 1] == com_sun_webkit_graphics_WCPathIterator_SEG_CLOSE);
+        if (!skip) {
+            function(type, coords.data() + ci);
+        }
+        ci += count;
+    }
+}
+
+// Mirrors com.sun.javafx.geom.Shape.pointCrossingsForLine()
+static int pointCrossingsForLine(float px, float py, float x0, float y0, float x1, float y1)
+{
+    if (py <  y0 && py <  y1) return 0;
+    if (py >= y0 && py >= y1) return 0;
+    if (px >= x0 && px >= x1) return 0;
+    if (px <  x0 && px <  x1) return (y0 < y1) ? 1 : -1;
+    float xintercept = x0 + (py - y0) * (x1 - x0) / (y1 - y0);
+    if (px >= xintercept) return 0;
+    return (y0 < y1) ? 1 : -1;
+}
+
 bool Path::contains(const FloatPoint& p, WindRule rule) const
 {
     ASSERT(m_path);
 
+    if (hasNativeLineSegmentsOnly()) {
+        if (!std::isfinite(p.x()) || !std::isfinite(p.y())) {
+            return false;
+        }
+        // Polygon crossings as computed by com.sun.javafx.geom.Path2D.contains()
+        float movx = 0, movy = 0, curx = 0, cury = 0;
+        int crossings = 0;
+        size_t segmentCount = 0;
+        forEachSegment(m_segmentTypes, m_segmentCoords, [&] (jint type, const jfloat* coords) {
+            switch (type) {
+            case com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO:
+                if (cury != movy) {
+                    crossings += pointCrossingsForLine(p.x(), p.y(), curx, cury, movx, movy);
+                }
+                movx = curx = coords[0];
+                movy = cury = coords[1];
+                break;
+            case com_sun_webkit_graphics_WCPathIterator_SEG_LINETO:
+                crossings += pointCrossingsForLine(p.x(), p.y(), curx, cury, coords[0], coords[1]);
+                curx = coords[0];
+                cury = coords[1];
+                break;
+            case com_sun_webkit_graphics_WCPathIterator_SEG_CLOSE:
+                if (cury != movy) {
+                    crossings += pointCrossingsForLine(p.x(), p.y(), curx, cury, movx, movy);
+                }
+                curx = movx;
+                cury = movy;
+                break;
+            }
+            ++segmentCount;
+        });
+        if (segmentCount < 2) {
+            return false;
+        }
+        if (cury != movy) {
+            crossings += pointCrossingsForLine(p.x(), p.y(), curx, cury, movx, movy);
+        }
+        int mask = (rule == WindRule::NonZero) ? -1 : 1;
+        return (crossings & mask) != 0;
+    }
+
+    flushSegments();
+
     JNIEnv* env = WebCore_GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "contains",
@@ -140,10 +304,53 @@ FloatRect Path::boundingRect() const
     return strokeBoundingRect(0);
 }
 
+static float strokeThickness(StrokeStyleApplier *applier)
+{
+    GraphicsContext& gc = scratchContext();
+    gc.save();
+    applier->strokeStyle(&gc);
+    float thickness = gc.strokeThickness();
+    gc.restore();
+    return thickness;
+}
+
 FloatRect Path::strokeBoundingRect(StrokeStyleApplier *applier) const
 {
     ASSERT(m_path);
 
+    if (hasNativeSegmentsOnly()) {
+        // The bounds of all the points, including the control ones,
+        // as computed by com.sun.javafx.geom.Path2D.getBounds()
+        bool hasPoints = false;
+        float x1 = 0, y1 = 0, x2 = 0, y2 = 0;
+        forEachSegment(m_segmentTypes, m_segmentCoords, [&] (jint type, const jfloat* coords) {
+            size_t count = type == com_sun_webkit_graphics_WCPathIterator_SEG_QUADTO ? 4
+                : type == com_sun_webkit_graphics_WCPathIterator_SEG_CUBICTO ? 6
+                : type == com_sun_webkit_graphics_WCPathIterator_SEG_CLOSE ? 0 : 2;
+            for (size_t i = 0; i < count; i += 2) {
+                float x = coords[i];
+                float y = coords[i + 1];
+                if (!hasPoints) {
+                    x1 = x2 = x;
+                    y1 = y2 = y;
+                    hasPoints = true;
+                    continue;
+                }
+                x1 = std::min(x1, x);
+                y1 = std::min(y1, y);
+                x2 = std::max(x2, x);
+                y2 = std::max(y2, y);
+            }
+        });
+        FloatRect bounds(x1, y1, x2 - x1, y2 - y1);
+        if (applier) {
+            bounds.inflate(strokeThickness(applier) / 2);
+        }
+        return bounds;
+    }
+
+    flushSegments();
+
     JNIEnv* env = WebCore_GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "getBounds",
@@ -169,14 +376,8 @@ FloatRect Path::strokeBoundingRect(StrokeStyleApplier *applier) const
             float(env->GetFloatField(rect, recthFID)));
         CheckAndClearException(env);
 
-        float thickness;
         if (applier) {
-            GraphicsContext& gc = scratchContext();
-            gc.save();
-            applier->strokeStyle(&gc);
-            thickness = gc.strokeThickness();
-            gc.restore();
-            bounds.inflate(thickness / 2);
+            bounds.inflate(strokeThickness(applier) / 2);
         }
         return bounds;
     } else {
@@ -188,20 +389,42 @@ void Path::clear()
 {
     ASSERT(m_path);
 
-    JNIEnv* env = WebCore_GetJavaEnv();
+    if (m_hasJavaOnlySegments || m_flushedTypeCount) {
+        JNIEnv* env = WebCore_GetJavaEnv();
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "clear", "()V");
-    ASSERT(mid);
+        static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
+            "clear", "()V");
+        ASSERT(mid);
 
-    env->CallVoidMethod(*m_path, mid);
-    CheckAndClearException(env);
+        env->CallVoidMethod(*m_path, mid);
+        CheckAndClearException(env);
+    }
+
+    m_segmentTypes.clear();
+    m_segmentCoords.clear();
+    m_flushedTypeCount = 0;
+    m_flushedCoordCount = 0;
+    m_hasJavaOnlySegments = false;
+    m_hasCurveSegments = false;
+    m_hasCurrentPoint = false;
 }
 
 bool Path::isEmpty() const
 {
     ASSERT(m_path);
 
+    if (hasNativeSegmentsOnly()) {
+        for (jint type : m_segmentTypes) {
+            if (type != com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO
+                    && type != com_sun_webkit_graphics_WCPathIterator_SEG_CLOSE) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    flushSegments();
+
     JNIEnv* env = WebCore_GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
@@ -216,18 +439,7 @@ bool Path::isEmpty() const
 
 bool Path::hasCurrentPoint() const
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WebCore_GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-                                            "hasCurrentPoint", "()Z");
-    ASSERT(mid);
-
-    jboolean res = env->CallBooleanMethod(*m_path, mid);
-    CheckAndClearException(env);
-
-    return jbool_to_bool(res);
+    return m_hasCurrentPoint;
 }
 
 FloatPoint Path::currentPoint() const
@@ -241,42 +453,33 @@ void Path::moveTo(const FloatPoint &p)
 {
     ASSERT(m_path);
 
-    JNIEnv* env = WebCore_GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "moveTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid, (jdouble)p.x(), (jdouble)p.y());
-    CheckAndClearException(env);
+    m_segmentTypes.append(com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO);
+    m_segmentCoords.append(p.x());
+    m_segmentCoords.append(p.y());
+    m_hasCurrentPoint = true;
 }
 
 void Path::addLineTo(const FloatPoint &p)
 {
     ASSERT(m_path);
 
-    JNIEnv* env = WebCore_GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addLineTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid, (jdouble)p.x(), (jdouble)p.y());
-    CheckAndClearException(env);
+    m_segmentTypes.append(com_sun_webkit_graphics_WCPathIterator_SEG_LINETO);
+    m_segmentCoords.append(p.x());
+    m_segmentCoords.append(p.y());
+    m_hasCurrentPoint = true;
 }
 
 void Path::addQuadCurveTo(const FloatPoint &cp, const FloatPoint &p)
 {
     ASSERT(m_path);
 
-    JNIEnv* env = WebCore_GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addQuadCurveTo",
-                                            "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid, (jdouble)cp.x(), (jdouble)cp.y(), (jdouble)p.x(), (jdouble)p.y());
-    CheckAndClearException(env);
+    m_segmentTypes.append(com_sun_webkit_graphics_WCPathIterator_SEG_QUADTO);
+    m_segmentCoords.append(cp.x());
+    m_segmentCoords.append(cp.y());
+    m_segmentCoords.append(p.x());
+    m_segmentCoords.append(p.y());
+    m_hasCurveSegments = true;
+    m_hasCurrentPoint = true;
 }
 
 void Path::addBezierCurveTo(const FloatPoint & controlPoint1,
@@ -285,23 +488,24 @@ void Path::addBezierCurveTo(const FloatPoint & controlPoint1,
 {
     ASSERT(m_path);
 
-    JNIEnv* env = WebCore_GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "addBezierCurveTo", "(DDDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid,
-                        (jdouble)controlPoint1.x(), (jdouble)controlPoint1.y(),
-                        (jdouble)controlPoint2.x(), (jdouble)controlPoint2.y(),
-                        (jdouble)controlPoint3.x(), (jdouble)controlPoint3.y());
-    CheckAndClearException(env);
+    m_segmentTypes.append(com_sun_webkit_graphics_WCPathIterator_SEG_CUBICTO);
+    m_segmentCoords.append(controlPoint1.x());
+    m_segmentCoords.append(controlPoint1.y());
+    m_segmentCoords.append(controlPoint2.x());
+    m_segmentCoords.append(controlPoint2.y());
+    m_segmentCoords.append(controlPoint3.x());
+    m_segmentCoords.append(controlPoint3.y());
+    m_hasCurveSegments = true;
+    m_hasCurrentPoint = true;
 }
 
 void Path::addArcTo(const FloatPoint & p1, const FloatPoint & p2, float radius)
 {
     ASSERT(m_path);
 
+    // The arc starts at the current point of the Java path.
+    flushSegments();
+
     JNIEnv* env = WebCore_GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArcTo",
@@ -312,20 +516,16 @@ void Path::addArcTo(const FloatPoint & p1, const FloatPoint & p2, float radius)
                         (jdouble)p1.x(), (jdouble)p1.y(),
                         (jdouble)p2.x(), (jdouble)p2.y(), (jdouble)radius);
     CheckAndClearException(env);
+
+    m_hasJavaOnlySegments = true;
+    m_hasCurrentPoint = true;
 }
 
 void Path::closeSubpath()
 {
     ASSERT(m_path);
 
-    JNIEnv* env = WebCore_GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "closeSubpath", "()V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid);
-    CheckAndClearException(env);
+    m_segmentTypes.append(com_sun_webkit_graphics_WCPathIterator_SEG_CLOSE);
 }
 
 void Path::addArc(const FloatPoint & p, float radius, float startAngle,
@@ -333,6 +533,8 @@ void Path::addArc(const FloatPoint & p, float radius, float startAngle,
 {
     ASSERT(m_path);
 
+    flushSegments();
+
     JNIEnv* env = WebCore_GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArc",
@@ -343,12 +545,17 @@ void Path::addArc(const FloatPoint & p, float radius, float startAngle,
         (jdouble)radius, (jdouble)startAngle, (jdouble)endAngle,
         bool_to_jbool(clockwise));
     CheckAndClearException(env);
+
+    m_hasJavaOnlySegments = true;
+    m_hasCurrentPoint = true;
 }
 
 void Path::addRect(const FloatRect& r)
 {
     ASSERT(m_path);
 
+    flushSegments();
+
     JNIEnv* env = WebCore_GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addRect",
@@ -358,6 +565,9 @@ void Path::addRect(const FloatRect& r)
     env->CallVoidMethod(*m_path, mid, (jdouble)r.x(), (jdouble)r.y(),
                               (jdouble)r.width(), (jdouble)r.height());
     CheckAndClearException(env);
+
+    m_hasJavaOnlySegments = true;
+    m_hasCurrentPoint = true;
 }
 
 void Path::addEllipse(FloatPoint, float, float, float, float, float, bool)
@@ -365,15 +575,62 @@ void Path::addEllipse(FloatPoint, float, float, float, float, float, bool)
     notImplemented();
 }
 
-void Path::addPath(const Path&, const AffineTransform&)
+void Path::addPath(const Path& path, const AffineTransform& at)
 {
-    notImplemented();
+    ASSERT(m_path);
+
+    if (path.hasNativeSegmentsOnly()) {
+        // The path may be this one, so only append what it had on entry,
+        // and index the vectors since appending may reallocate them.
+        size_t typeCount = path.m_segmentTypes.size();
+        size_t coordCount = path.m_segmentCoords.size();
+        m_segmentTypes.reserveCapacity(m_segmentTypes.size() + typeCount);
+        m_segmentCoords.reserveCapacity(m_segmentCoords.size() + coordCount);
+        for (size_t i = 0; i < typeCount; ++i) {
+            m_segmentTypes.append(path.m_segmentTypes[i]);
+        }
+        for (size_t i = 0; i + 1 < coordCount; i += 2) {
+            FloatPoint p = at.mapPoint(FloatPoint(path.m_segmentCoords[i], path.m_segmentCoords[i + 1]));
+            m_segmentCoords.append(p.x());
+            m_segmentCoords.append(p.y());
+        }
+        m_hasCurveSegments = m_hasCurveSegments || path.m_hasCurveSegments;
+        m_hasCurrentPoint = m_hasCurrentPoint || path.m_hasCurrentPoint;
+        return;
+    }
+
+    if (!at.isIdentity()) {
+        notImplemented();
+        return;
+    }
+
+    if (&path == this) {
+        // Appending a path to itself would iterate over it while it grows.
+        addPath(Path(path), at);
+        return;
+    }
+
+    flushSegments();
+
+    JNIEnv* env = WebCore_GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
+        "addPath", "(Lcom/sun/webkit/graphics/WCPath;)V");
+    ASSERT(mid);
+
+    env->CallVoidMethod(*m_path, mid, (jobject)*path.platformPath());
+    CheckAndClearException(env);
+
+    m_hasJavaOnlySegments = true;
+    m_hasCurrentPoint = m_hasCurrentPoint || path.m_hasCurrentPoint;
 }
 
 void Path::addEllipse(const FloatRect& r)
 {
     ASSERT(m_path);
 
+    flushSegments();
+
     JNIEnv* env = WebCore_GetJavaEnv();
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addEllipse",
         "(DDDD)V");
@@ -383,43 +640,104 @@ void Path::addEllipse(const FloatRect& r)
                         (jdouble)r.x(), (jdouble)r.y(),
                         (jdouble)r.width(), (jdouble)r.height());
     CheckAndClearException(env);
+
+    m_hasJavaOnlySegments = true;
+    m_hasCurrentPoint = true;
 }
 
 void Path::translate(const FloatSize &sz)
 {
     ASSERT(m_path);
 
-    JNIEnv* env = WebCore_GetJavaEnv();
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "translate",
-        "(DD)V");
-    ASSERT(mid);
+    // All the segments are translated natively, the Java path is only
+    // updated if it has any.
+    if (m_hasJavaOnlySegments || m_flushedTypeCount) {
+        flushSegments();
 
-    env->CallVoidMethod(*m_path, mid,
-                        (jdouble)sz.width(), (jdouble)sz.height());
-    CheckAndClearException(env);
+        JNIEnv* env = WebCore_GetJavaEnv();
+        static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "translate",
+            "(DD)V");
+        ASSERT(mid);
+
+        env->CallVoidMethod(*m_path, mid,
+                            (jdouble)sz.width(), (jdouble)sz.height());
+        CheckAndClearException(env);
+    }
+
+    for (size_t i = 0; i + 1 < m_segmentCoords.size(); i += 2) {
+        m_segmentCoords[i] += sz.width();
+        m_segmentCoords[i + 1] += sz.height();
+    }
 }
 
 void Path::transform(const AffineTransform &at)
 {
     ASSERT(m_path);
 
-    JNIEnv* env = WebCore_GetJavaEnv();
+    if (m_hasJavaOnlySegments || m_flushedTypeCount) {
+        flushSegments();
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "transform", "(DDDDDD)V");
-    ASSERT(mid);
+        JNIEnv* env = WebCore_GetJavaEnv();
 
-    env->CallVoidMethod(*m_path, mid,
-                        (jdouble)at.a(), (jdouble)at.b(),
-                        (jdouble)at.c(), (jdouble)at.d(),
-                        (jdouble)at.e(), (jdouble)at.f());
-    CheckAndClearException(env);
+        static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
+            "transform", "(DDDDDD)V");
+        ASSERT(mid);
+
+        env->CallVoidMethod(*m_path, mid,
+                            (jdouble)at.a(), (jdouble)at.b(),
+                            (jdouble)at.c(), (jdouble)at.d(),
+                            (jdouble)at.e(), (jdouble)at.f());
+        CheckAndClearException(env);
+    }
+
+    for (size_t i = 0; i + 1 < m_segmentCoords.size(); i += 2) {
+        FloatPoint p = at.mapPoint(FloatPoint(m_segmentCoords[i], m_segmentCoords[i + 1]));
+        m_segmentCoords[i] = p.x();
+        m_segmentCoords[i + 1] = p.y();
+    }
 }
 
 void Path::apply(const PathApplierFunction& function) const
 {
     ASSERT(m_path);
 
+    if (hasNativeSegmentsOnly()) {
+        PathElement pelement;
+        FloatPoint points[3];
+        pelement.points = points;
+
+        forEachSegment(m_segmentTypes, m_segmentCoords, [&] (jint type, const jfloat* data) {
+            switch (type) {
+            case com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO:
+                pelement.type = PathElementMoveToPoint;
+                pelement.points[0] = FloatPoint(data[0], data[1]);
+                break;
+            case com_sun_webkit_graphics_WCPathIterator_SEG_LINETO:
+                pelement.type = PathElementAddLineToPoint;
+                pelement.points[0] = FloatPoint(data[0], data[1]);
+                break;
+            case com_sun_webkit_graphics_WCPathIterator_SEG_QUADTO:
+                pelement.type = PathElementAddQuadCurveToPoint;
+                pelement.points[0] = FloatPoint(data[0], data[1]);
+                pelement.points[1] = FloatPoint(data[2], data[3]);
+                break;
+            case com_sun_webkit_graphics_WCPathIterator_SEG_CUBICTO:
+                pelement.type = PathElementAddCurveToPoint;
+                pelement.points[0] = FloatPoint(data[0], data[1]);
+                pelement.points[1] = FloatPoint(data[2], data[3]);
+                pelement.points[2] = FloatPoint(data[4], data[5]);
+                break;
+            case com_sun_webkit_graphics_WCPathIterator_SEG_CLOSE:
+                pelement.type = PathElementCloseSubpath;
+                break;
+            }
+            function(pelement);
+        });
+        return;
+    }
+
+    flushSegments();
+
     JNIEnv* env = WebCore_GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include "AffineTransform.h"
 #include "GraphicsContext.h"
 #include "wtf/Noncopyable.h"
 #include "RenderingQueue.h"
@@ -68,15 +69,8 @@ namespace WebCore {
             m_path.clear();
         }
 
-        void addPath(PlatformPathPtr pPath) {
-            JNIEnv* env = WebCore_GetJavaEnv();
-
-            static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-                "addPath", "(Lcom/sun/webkit/graphics/WCPath;)V");
-            ASSERT(mid);
-
-            env->CallVoidMethod((jobject)*m_path.platformPath(), mid, (jobject)*pPath);
-            CheckAndClearException(env);
+        void addPath(const Path& path) {
+            m_path.addPath(path, AffineTransform());
         }
 
         PlatformPathPtr platformPath() {
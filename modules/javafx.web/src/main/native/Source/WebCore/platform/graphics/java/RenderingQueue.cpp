@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,45 @@ static Addr2ByteBuffer& getAddr2ByteBuffer()
     return container.get();
 }
 
+/*
+ * Released ByteBuffers are kept here to be reused by the subsequent paints,
+ * so the steady-state rendering neither allocates native memory nor creates
+ * new NIO objects. It's accessed on the Event thread only.
+ */
+typedef Vector<RefPtr<ByteBuffer> > ByteBufferPool;
+
+static ByteBufferPool& getByteBufferPool()
+{
+    static NeverDestroyed<ByteBufferPool> pool;
+    return pool.get();
+}
+
+static RefPtr<ByteBuffer> acquireByteBuffer(int capacity)
+{
+    ByteBufferPool& pool = getByteBufferPool();
+    for (size_t i = pool.size(); i > 0; --i) {
+        if (pool[i - 1]->capacity() == capacity) {
+            RefPtr<ByteBuffer> buffer = WTFMove(pool[i - 1]);
+            pool.remove(i - 1);
+            return buffer;
+        }
+    }
+    return ByteBuffer::create(capacity);
+}
+
+static void recycleByteBuffer(RefPtr<ByteBuffer>&& buffer)
+{
+    ByteBufferPool& pool = getByteBufferPool();
+    // Oversized buffers are created for the rare commands that don't fit into
+    // the default capacity, don't keep them.
+    if (buffer->capacity() > com_sun_webkit_graphics_WCRenderQueue_MAX_QUEUE_SIZE / (int)RenderingQueue::MAX_BUFFER_COUNT
+        || pool.size() >= RenderingQueue::MAX_RECYCLED_BUFFER_COUNT) {
+        return;
+    }
+    buffer->reset();
+    pool.append(WTFMove(buffer));
+}
+
 /*static*/
 RefPtr<RenderingQueue> RenderingQueue::create(
     const JLObject &jRQ,
@@ -65,7 +104,7 @@ RenderingQueue& RenderingQueue::freeSpace(int size) {
         }
     }
     if (!m_buffer) {
-        m_buffer = RefPtr<ByteBuffer>(ByteBuffer::create(std::max(m_capacity, size)));
+        m_buffer = acquireByteBuffer(std::max(m_capacity, size));
     }
     return *this;
 }
@@ -106,7 +145,7 @@ RenderingQueue& RenderingQueue::flushBuffer() {
     JNIEnv* env = WebCore_GetJavaEnv();
 
     static jmethodID midFwkAddBuffer = env->GetMethodID(PG_GetRenderQueueClass(env),
-        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;)V");
+        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;I)V");
     ASSERT(midFwkAddBuffer);
 
     Addr2ByteBuffer &a2bb = getAddr2ByteBuffer();
@@ -114,7 +153,8 @@ RenderingQueue& RenderingQueue::flushBuffer() {
     env->CallVoidMethod(
         getWCRenderingQueue(),
         midFwkAddBuffer,
-        (jobject)(m_buffer->createDirectByteBuffer(env)));
+        (jobject)(m_buffer->getDirectByteBuffer(env)),
+        (jint)m_buffer->position());
     CheckAndClearException(env);
 
     m_buffer = nullptr;
@@ -141,7 +181,10 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkRelease
         char *key = (char *)env->GetDirectBufferAddress(
             JLObject(env->GetObjectArrayElement(bufs, i)));
         if (key != 0) {
-            a2bb.remove(key);
+            RefPtr<ByteBuffer> buffer = a2bb.take(key);
+            if (buffer && buffer->hasOneRef()) {
+                recycleByteBuffer(WTFMove(buffer));
+            }
         }
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -44,15 +44,33 @@ public:
         return adoptRef(new ByteBuffer(capacity));
     }
 
-    JLObject createDirectByteBuffer(JNIEnv* env) {
+    // The NIO wrapper spans the whole native storage and is created once per
+    // ByteBuffer; the Java side limits it to position() when the buffer is added
+    // to a WCRenderQueue. This lets a recycled ByteBuffer be handed out again
+    // without creating a new java.nio.ByteBuffer.
+    JLObject getDirectByteBuffer(JNIEnv* env) {
         ASSERT(!isEmpty());
-        JLObject ret(env->NewDirectByteBuffer(m_buffer, m_position));
-        m_nio_holder = ret;
-        return ret;
+        if (!m_nio_holder) {
+            JLObject ret(env->NewDirectByteBuffer(m_buffer, m_capacity));
+            m_nio_holder = ret;
+            return ret;
+        }
+        return JLObject(m_nio_holder);
     }
 
     char* bufferAddress() { return m_buffer; }
 
+    int capacity() { return m_capacity; }
+
+    int position() { return m_position; }
+
+    // Makes the buffer ready for reuse. Should be called on the Event thread,
+    // since it releases the resources kept in m_refList.
+    void reset() {
+        m_position = 0;
+        m_refList.clear();
+    }
+
     void putRef(RefPtr<RQRef> ref) {
         ASSERT(m_position + sizeof(jint) <= m_capacity);
         RefPtr<RQRef> repeatable_use_holder(ref);
@@ -108,6 +126,8 @@ class RenderingQueue : public RefCounted<RenderingQueue> {
     RQ_LOG_INSTANCE_COUNT(RenderingQueue)
 public:
     static const size_t MAX_BUFFER_COUNT = 8;
+    // Upper bound of the released ByteBuffers kept for reuse (see twkRelease).
+    static const size_t MAX_RECYCLED_BUFFER_COUNT = 4 * MAX_BUFFER_COUNT;
 
     static RefPtr<RenderingQueue> create(
         const JLObject &jRQ,
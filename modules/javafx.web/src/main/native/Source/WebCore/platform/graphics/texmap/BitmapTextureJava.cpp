@@ -67,6 +67,14 @@ void BitmapTextureJava::updateContents(TextureMapper& mapper, GraphicsLayer* sou
 
 void BitmapTextureJava::didReset()
 {
+    // Pooled textures are reset whenever they are handed out again, e.g. for
+    // every intermediate surface of every frame. Keep the Java image around
+    // if it already has the requested size.
+    if (m_image && m_image->internalSize() == contentSize()) {
+        m_image->context().clearRect(IntRect(IntPoint(), contentSize()));
+        return;
+    }
+
     float devicePixelRatio = 1.0;
     m_image = ImageBuffer::create(contentSize(), Accelerated, devicePixelRatio);
 }
@@ -37,6 +37,11 @@ namespace WebCore {
 
 static const Seconds releaseUnusedSecondsTolerance { 3_s };
 static const Seconds releaseUnusedTexturesTimerInterval { 500_ms };
+#if PLATFORM(JAVA)
+// Upper bound for the textures kept around without being used, e.g. the
+// tiles of layers that went away. That's 128 tiles of 256x256.
+static const size_t maxUnusedTextureBytes = 32 * 1024 * 1024;
+#endif
 
 #if USE(TEXTURE_MAPPER_GL)
 BitmapTexturePool::BitmapTexturePool(const TextureMapperContextAttributes& contextAttributes)
@@ -57,6 +62,9 @@ RefPtr<BitmapTexture> BitmapTexturePool::acquireTexture(const IntSize& size, con
         [&size](Entry& entry) { return entry.m_texture->refCount() == 1 && entry.m_texture->size() == size; });
 
     if (selectedEntry == m_textures.end()) {
+#if PLATFORM(JAVA)
+        releaseUnusedTexturesOverBudget();
+#endif
         m_textures.append(Entry(createTexture(flags)));
         selectedEntry = &m_textures.last();
     }
@@ -90,6 +98,29 @@ void BitmapTexturePool::releaseUnusedTexturesTimerFired()
         scheduleReleaseUnusedTextures();
 }
 
+#if PLATFORM(JAVA)
+void BitmapTexturePool::releaseUnusedTexturesOverBudget()
+{
+    size_t unusedBytes = 0;
+    for (auto& entry : m_textures) {
+        if (entry.m_texture->refCount() == 1)
+            unusedBytes += entry.m_texture->numberOfBytes();
+    }
+
+    // Drop the least recently used textures first.
+    while (unusedBytes > maxUnusedTextureBytes) {
+        Entry* oldestEntry = nullptr;
+        for (auto& entry : m_textures) {
+            if (entry.m_texture->refCount() == 1 && (!oldestEntry || entry.m_lastUsedTime < oldestEntry->m_lastUsedTime))
+                oldestEntry = &entry;
+        }
+        ASSERT(oldestEntry);
+        unusedBytes -= oldestEntry->m_texture->numberOfBytes();
+        m_textures.remove(oldestEntry - m_textures.begin());
+    }
+}
+#endif
+
 RefPtr<BitmapTexture> BitmapTexturePool::createTexture(const BitmapTexture::Flags flags)
 {
 #if USE(TEXTURE_MAPPER_GL)
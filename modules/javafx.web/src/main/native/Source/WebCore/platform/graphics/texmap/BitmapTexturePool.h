@@ -62,6 +62,9 @@ private:
 
     void scheduleReleaseUnusedTextures();
     void releaseUnusedTexturesTimerFired();
+#if PLATFORM(JAVA)
+    void releaseUnusedTexturesOverBudget();
+#endif
     RefPtr<BitmapTexture> createTexture(const BitmapTexture::Flags);
 
 #if USE(TEXTURE_MAPPER_GL)
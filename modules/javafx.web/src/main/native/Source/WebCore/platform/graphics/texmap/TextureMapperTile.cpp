@@ -41,8 +41,12 @@ void TextureMapperTile::updateContents(TextureMapper& textureMapper, Image* imag
     // Normalize targetRect to the texture's coordinates.
     targetRect.move(-m_rect.x(), -m_rect.y());
     if (!m_texture) {
+#if PLATFORM(JAVA)
+        m_texture = textureMapper.acquireTextureFromPool(enclosingIntRect(m_rect).size(), image->currentFrameKnownToBeOpaque() ? 0 : BitmapTexture::SupportsAlpha);
+#else
         m_texture = textureMapper.createTexture();
         m_texture->reset(targetRect.size(), image->currentFrameKnownToBeOpaque() ? 0 : BitmapTexture::SupportsAlpha);
+#endif
     }
 
     m_texture->updateContents(image, targetRect, sourceOffset);
@@ -60,8 +64,15 @@ void TextureMapperTile::updateContents(TextureMapper& textureMapper, GraphicsLay
     targetRect.move(-m_rect.x(), -m_rect.y());
 
     if (!m_texture) {
+#if PLATFORM(JAVA)
+        // Size the texture for the whole tile, so that later damage outside
+        // of the first dirty rect still fits, and recycle the textures of
+        // discarded tiles through the pool.
+        m_texture = textureMapper.acquireTextureFromPool(enclosingIntRect(m_rect).size(), BitmapTexture::SupportsAlpha);
+#else
         m_texture = textureMapper.createTexture();
         m_texture->reset(targetRect.size(), BitmapTexture::SupportsAlpha);
+#endif
     }
 
     m_texture->updateContents(textureMapper, sourceLayer, targetRect, sourceOffset, scale);
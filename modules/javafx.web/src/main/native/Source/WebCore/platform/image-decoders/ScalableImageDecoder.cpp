@@ -25,10 +25,12 @@
 
 #include "BMPImageDecoder.h"
 #include "GIFImageDecoder.h"
+#include "SharedBuffer.h"
+#if !PLATFORM(JAVA)
 #include "ICOImageDecoder.h"
 #include "JPEGImageDecoder.h"
 #include "PNGImageDecoder.h"
-#include "SharedBuffer.h"
+#endif
 #if USE(WEBP)
 #include "WEBPImageDecoder.h"
 #endif
@@ -64,6 +66,7 @@ bool matchesGIFSignature(char* contents)
     return !memcmp(contents, "GIF87a", 6) || !memcmp(contents, "GIF89a", 6);
 }
 
+#if !PLATFORM(JAVA)
 bool matchesPNGSignature(char* contents)
 {
     return !memcmp(contents, "\x89\x50\x4E\x47\x0D\x0A\x1A\x0A", 8);
@@ -73,6 +76,7 @@ bool matchesJPEGSignature(char* contents)
 {
     return !memcmp(contents, "\xFF\xD8\xFF", 3);
 }
+#endif
 
 #if USE(WEBP)
 bool matchesWebPSignature(char* contents)
@@ -86,6 +90,7 @@ bool matchesBMPSignature(char* contents)
     return !memcmp(contents, "BM", 2);
 }
 
+#if !PLATFORM(JAVA)
 bool matchesICOSignature(char* contents)
 {
     return !memcmp(contents, "\x00\x00\x01\x00", 4);
@@ -95,12 +100,12 @@ bool matchesCURSignature(char* contents)
 {
     return !memcmp(contents, "\x00\x00\x02\x00", 4);
 }
+#endif
 
 }
 
 RefPtr<ScalableImageDecoder> ScalableImageDecoder::create(SharedBuffer& data, AlphaOption alphaOption, GammaAndColorProfileOption gammaAndColorProfileOption)
 {
-    static const unsigned lengthOfLongestSignature = 14; // To wit: "RIFF????WEBPVP"
     char contents[lengthOfLongestSignature];
     unsigned length = copyFromSharedBuffer(contents, lengthOfLongestSignature, data);
     if (length < lengthOfLongestSignature)
@@ -109,6 +114,9 @@ RefPtr<ScalableImageDecoder> ScalableImageDecoder::create(SharedBuffer& data, Al
     if (matchesGIFSignature(contents))
         return GIFImageDecoder::create(alphaOption, gammaAndColorProfileOption);
 
+#if !PLATFORM(JAVA)
+    // The Java port does not bundle libpng/libjpeg; these formats keep
+    // going through ImageDecoderJava.
     if (matchesPNGSignature(contents))
         return PNGImageDecoder::create(alphaOption, gammaAndColorProfileOption);
 
@@ -117,6 +125,7 @@ RefPtr<ScalableImageDecoder> ScalableImageDecoder::create(SharedBuffer& data, Al
 
     if (matchesJPEGSignature(contents))
         return JPEGImageDecoder::create(alphaOption, gammaAndColorProfileOption);
+#endif
 
 #if USE(WEBP)
     if (matchesWebPSignature(contents))
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "ImageBackingStore.h"
+
+#include "RQRef.h"
+#include <wtf/java/JavaEnv.h>
+
+namespace WebCore {
+
+NativeImagePtr ImageBackingStore::image() const
+{
+    JNIEnv* env = WebCore_GetJavaEnv();
+    if (!env) {
+        return { };
+    }
+
+    static jmethodID midCreateFrame = env->GetMethodID(
+        PG_GetGraphicsManagerClass(env),
+        "createFrame",
+        "(IILjava/nio/ByteBuffer;)Lcom/sun/webkit/graphics/WCImageFrame;");
+    ASSERT(midCreateFrame);
+
+    // The pixels are premultiplied ARGB words in native byte order, which is
+    // what createFrame() expects. The Java side copies them into its own
+    // int[], so the buffer only has to stay alive for the duration of the call.
+    JLObject data(env->NewDirectByteBuffer(
+        m_pixelsPtr,
+        (m_size.area() * sizeof(RGBA32)).unsafeGet()));
+    if (!data) {
+        CheckAndClearException(env);
+        return { };
+    }
+
+    JLObject frame(env->CallObjectMethod(
+        PL_GetGraphicsManager(env),
+        midCreateFrame,
+        m_size.width(),
+        m_size.height(),
+        (jobject)data));
+    CheckAndClearException(env);
+    if (!frame) {
+        return { };
+    }
+
+    return RQRef::create(frame);
+}
+
+} // namespace WebCore
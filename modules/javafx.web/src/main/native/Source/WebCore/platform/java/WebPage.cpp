@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -53,10 +53,13 @@
 #include <WebCore/FrameTree.h>
 #include <WebCore/FrameLoadRequest.h>
 #include <WebCore/FrameView.h>
+#include <WebCore/CommonVM.h>
 #include <WebCore/GCController.h>
 #include <WebCore/HTMLFormElement.h>
 #include <WebCore/InspectorController.h>
 #include <WebCore/KeyboardEvent.h>
+#include <WebCore/MemoryCache.h>
+#include <WebCore/MemoryRelease.h>
 
 #include <WebCore/NodeTraversal.h>
 #include <WebCore/Page.h>
@@ -72,10 +75,13 @@
 #include <JavaScriptCore/inspector/InspectorAgentBase.h>
 #include <JavaScriptCore/JSContextRefPrivate.h>
 #include <JavaScriptCore/JSContextRef.h>
+#include <JavaScriptCore/SamplingProfiler.h>
 #include <JavaScriptCore/ScriptValue.h>
+#include <JavaScriptCore/VM.h>
 #include <wtf/java/DbgUtils.h>
 #include <wtf/java/JavaRef.h>
 #include <wtf/RunLoop.h>
+#include <wtf/Stopwatch.h>
 
 #include "TextureMapperJava.h"
 #include "TextureMapperLayer.h"
@@ -85,6 +91,7 @@
 #include "ContextMenu.h"
 #include "ContextMenuJava.h"
 #include "ContextMenuClientJava.h"
+#include "DisplayRefreshMonitorJava.h"
 #include "DragClientJava.h"
 #include "DragData.h"
 #include "Font.h"
@@ -93,6 +100,7 @@
 #include "EditorClientJava.h"
 #include "GeolocationClientMock.h"
 #include "GraphicsContext.h"
+#include "ImageDecoderJava.h"
 #include "InspectorClientJava.h"
 #include "PlatformContextJava.h"
 #include "PlatformKeyboardEvent.h"
@@ -400,6 +408,8 @@ void WebPage::setRootChildLayer(GraphicsLayer* layer)
     } else {
         m_rootLayer.reset();
         m_textureMapper.reset();
+        // The content painted while in the compositing mode is obsolete.
+        requestJavaRepaint(pageRect());
     }
 }
 
@@ -850,7 +860,10 @@ namespace {
 
 bool s_useJIT;
 bool s_useDFGJIT;
+bool s_useFTLJIT;
 bool s_useCSS3D;
+Seconds s_parserTimeLimit;
+size_t s_jsHeapBudget;
 
 }  // namespace
 
@@ -859,10 +872,19 @@ extern "C" {
 #endif
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInitWebCore
-    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useCSS3D) {
+    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useFTLJIT, jboolean useCSS3D, jboolean useNativeImageDecoders, jint parserTimeLimit, jint pulseRate, jint jsHeapBudget) {
     s_useJIT = useJIT;
     s_useDFGJIT = useDFGJIT;
+    s_useFTLJIT = useFTLJIT;
     s_useCSS3D = useCSS3D;
+    s_parserTimeLimit = Seconds::fromMilliseconds(parserTimeLimit);
+    s_jsHeapBudget = static_cast<size_t>(std::max(jsHeapBudget, 0)) * MB;
+    ImageDecoderJava::setUseNativeDecoders(useNativeImageDecoders);
+#if USE(REQUEST_ANIMATION_FRAME_DISPLAY_MONITOR)
+    if (pulseRate > 0) {
+        DisplayRefreshMonitorJava::setRefreshInterval(1_s / pulseRate);
+    }
+#endif
 }
 
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
@@ -892,6 +914,22 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
         JSC::Options::useJIT() = s_useJIT;
         // Enable DFG only if JIT is enabled.
         JSC::Options::useDFGJIT() = s_useJIT && s_useDFGJIT;
+        // FTL is opt-in, and needs DFG. It is a no-op where it is not built.
+        JSC::Options::useFTLJIT() = s_useJIT && s_useDFGJIT && s_useFTLJIT;
+        // WebAssembly needs the JIT. Options::initialize() already derived
+        // it from the default useJIT, so it has to follow the flag here.
+        JSC::Options::useWebAssembly() = s_useJIT;
+        // Fast memory bounds checks rely on a SIGSEGV handler, which belongs
+        // to the JVM; use explicit bounds checks instead.
+        JSC::Options::useWebAssemblyFastMemory() = false;
+        // Size the JS heap against the budget instead of the physical RAM, so
+        // that its growth and critical GC thresholds scale with the budget.
+        // The option is process wide: worker VMs are sized against it too,
+        // each separately, while only commonVM() is collected when over it.
+        if (s_jsHeapBudget) {
+            JSC::Options::forceRAMSize() = static_cast<unsigned>(
+                std::min<size_t>(s_jsHeapBudget, std::numeric_limits<unsigned>::max()));
+        }
     });
 
     JLObject jlself(self, true);
@@ -948,6 +986,11 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInit
     settings.setContextMenuEnabled(true);
     settings.setUserAgent(defaultUserAgent());
     settings.setMaximumHTMLParserDOMTreeDepth(180);
+    // Let a long parse yield to the event thread well before WebCore's
+    // default of half a second, so input keeps being handled.
+    if (s_parserTimeLimit > 0_s) {
+        settings.setMaxParseDuration(s_parserTimeLimit.seconds());
+    }
     settings.setXSSAuditorEnabled(true);
     settings.setInteractiveFormValidationEnabled(true);
 
@@ -2480,9 +2523,102 @@ JNIEXPORT jint JNICALL Java_com_sun_webkit_WebPage_twkWorkerThreadCount
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkDoJSCGarbageCollection
-  (JNIEnv*, jclass)
+  (JNIEnv*, jclass, jboolean lowMemory)
 {
-    GCController::singleton().garbageCollectNow();
+    if (lowMemory) {
+        // The JVM heap is nearly exhausted: drop caches and compiled code too.
+        releaseMemory(Critical::Yes, Synchronous::Yes);
+        return;
+    }
+
+    JSC::VM& vm = commonVM();
+    JSC::JSLockHolder lock(vm);
+    if (s_jsHeapBudget && vm.heap.size() > s_jsHeapBudget) {
+        GCController::singleton().garbageCollectNow();
+        return;
+    }
+    // Objects unprotected by JSObject disposal since the last JVM GC are
+    // often old, which an eden collection doesn't reclaim. Let the heap pick
+    // the scope: it runs eden collections until the old generation has grown
+    // enough to warrant a full one.
+    vm.heap.collectAsync();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkStartSamplingProfiler
+  (JNIEnv*, jclass, jint intervalMicros)
+{
+#if ENABLE(SAMPLING_PROFILER)
+    JSC::VM& vm = commonVM();
+    JSC::JSLockHolder lock(vm);
+    Ref<Stopwatch> stopwatch = Stopwatch::create();
+    stopwatch->start();
+    JSC::SamplingProfiler& samplingProfiler = vm.ensureSamplingProfiler(stopwatch.copyRef());
+
+    LockHolder locker(samplingProfiler.getLock());
+    if (intervalMicros > 0) {
+        samplingProfiler.setTimingInterval(Seconds::fromMicroseconds(intervalMicros));
+    }
+    samplingProfiler.setStopWatch(locker, WTFMove(stopwatch));
+    samplingProfiler.noticeCurrentThreadAsJSCExecutionThread(locker);
+    samplingProfiler.start(locker);
+#else
+    UNUSED_PARAM(intervalMicros);
+#endif
+}
+
+JNIEXPORT jstring JNICALL Java_com_sun_webkit_WebPage_twkStopSamplingProfiler
+  (JNIEnv* env, jclass)
+{
+#if ENABLE(SAMPLING_PROFILER)
+    JSC::VM& vm = commonVM();
+    JSC::JSLockHolder lock(vm);
+    JSC::SamplingProfiler* samplingProfiler = vm.samplingProfiler();
+    if (!samplingProfiler) {
+        return nullptr;
+    }
+    {
+        LockHolder locker(samplingProfiler->getLock());
+        samplingProfiler->pause(locker);
+    }
+    return samplingProfiler->stackTracesAsFoldedStacks().toJavaString(env).releaseLocal();
+#else
+    UNUSED_PARAM(env);
+    return nullptr;
+#endif
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetMemoryCacheCapacities
+  (JNIEnv*, jclass, jint minDeadBytes, jint maxDeadBytes, jint totalBytes)
+{
+    // Shrinking the capacities prunes the cache right away.
+    MemoryCache::singleton().setCapacities(minDeadBytes, maxDeadBytes, totalBytes);
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetShareDirectBuffers
+  (JNIEnv*, jclass, jboolean share)
+{
+    WebCore::setShareDirectBuffers(share);
+}
+
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_WebPage_twkGetMemoryCacheStatistics
+  (JNIEnv* env, jclass)
+{
+    auto& memoryCache = MemoryCache::singleton();
+    auto& counters = memoryCache.counters();
+
+    jlongArray result = env->NewLongArray(6);
+    CheckAndClearException(env);
+
+    jlong* arr = (jlong*)env->GetPrimitiveArrayCritical(result, NULL);
+    arr[0] = counters.hits;
+    arr[1] = counters.revalidations;
+    arr[2] = counters.misses;
+    arr[3] = counters.evictedBytes;
+    arr[4] = counters.destroyedDecodedBytes;
+    arr[5] = memoryCache.size();
+    env->ReleasePrimitiveArrayCritical(result, arr, 0);
+
+    return result;
 }
 
 #ifdef __cplusplus
@@ -18,6 +18,7 @@
 #include "ResourceRequest.h"
 #include "ResourceResponse.h"
 #include "ResourceHandleClient.h"
+#include "SharedBuffer.h"
 #include "WebPage.h"
 #include "com_sun_webkit_LoadListenerClient.h"
 #include "com_sun_webkit_network_URLLoader.h"
@@ -318,11 +319,11 @@ void URLLoader::AsynchronousTarget::didReceiveResponse(
     }
 }
 
-void URLLoader::AsynchronousTarget::didReceiveData(const char* data, int length)
+void URLLoader::AsynchronousTarget::didReceiveData(Vector<char>&& data)
 {
     ResourceHandleClient* client = m_handle->client();
     if (client) {
-        client->didReceiveData(m_handle, data, length, 0);
+        client->didReceiveBuffer(m_handle, SharedBuffer::create(WTFMove(data)), 0);
     }
 }
 
@@ -383,9 +384,13 @@ void URLLoader::SynchronousTarget::didReceiveResponse(
     m_response = response;
 }
 
-void URLLoader::SynchronousTarget::didReceiveData(const char* data, int length)
+void URLLoader::SynchronousTarget::didReceiveData(Vector<char>&& data)
 {
-    m_data.append(data, length);
+    if (m_data.isEmpty()) {
+        m_data = WTFMove(data);
+    } else {
+        m_data.appendVector(data);
+    }
 }
 
 void URLLoader::SynchronousTarget::didFinishLoading()
@@ -525,16 +530,50 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoader_twkDidReceiveRespon
     target->didReceiveResponse(response);
 }
 
+// Response data is read into natively allocated chunks so that the filled
+// chunk can be adopted as a SharedBuffer segment without another copy.
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_network_URLLoader_twkCreateChunk
+  (JNIEnv*, jclass, jint capacity)
+{
+    auto chunk = std::make_unique<Vector<char>>();
+    if (!chunk->tryReserveCapacity(capacity)) {
+        return 0;
+    }
+    // No initialization cost, char is a POD type.
+    chunk->grow(capacity);
+    return ptr_to_jlong(chunk.release());
+}
+
+JNIEXPORT jobject JNICALL Java_com_sun_webkit_network_URLLoader_twkGetChunkBuffer
+  (JNIEnv* env, jclass, jlong chunk)
+{
+    Vector<char>* vector = static_cast<Vector<char>*>(jlong_to_ptr(chunk));
+    ASSERT(vector);
+    return env->NewDirectByteBuffer(vector->data(), vector->size());
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoader_twkDisposeChunk
+  (JNIEnv*, jclass, jlong chunk)
+{
+    delete static_cast<Vector<char>*>(jlong_to_ptr(chunk));
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoader_twkDidReceiveData
-  (JNIEnv* env, jclass, jobject byteBuffer, jint position, jint remaining,
-   jlong data)
+  (JNIEnv*, jclass, jlong chunk, jint length, jlong data)
 {
     URLLoader::Target* target =
             static_cast<URLLoader::Target*>(jlong_to_ptr(data));
     ASSERT(target);
-    const char* address =
-            static_cast<const char*>(env->GetDirectBufferAddress(byteBuffer));
-    target->didReceiveData(address + position, remaining);
+    std::unique_ptr<Vector<char>> vector(
+            static_cast<Vector<char>*>(jlong_to_ptr(chunk)));
+    ASSERT(vector && static_cast<size_t>(length) <= vector->size());
+    vector->shrink(length);
+    // Give back the slack of a partially filled chunk, typically the
+    // last one of a response of unknown length.
+    if (vector->capacity() - vector->size() > vector->capacity() / 4) {
+        vector->shrinkToFit();
+    }
+    target->didReceiveData(WTFMove(*vector));
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoader_twkDidFinishLoading
@@ -37,7 +37,7 @@ public:
                                      const String& newMethod,
                                      const ResourceResponse& response) = 0;
         virtual void didReceiveResponse(const ResourceResponse& response) = 0;
-        virtual void didReceiveData(const char* data, int length) = 0;
+        virtual void didReceiveData(Vector<char>&& data) = 0;
         virtual void didFinishLoading() = 0;
         virtual void didFail(const ResourceError& error) = 0;
         virtual ~Target();
@@ -61,7 +61,7 @@ private:
                              const String& newMethod,
                              const ResourceResponse& response) final;
         void didReceiveResponse(const ResourceResponse& response) final;
-        void didReceiveData(const char* data, int length) final;
+        void didReceiveData(Vector<char>&& data) final;
         void didFinishLoading() final;
         void didFail(const ResourceError& error) final;
     private:
@@ -80,7 +80,7 @@ private:
                              const String& newMethod,
                              const ResourceResponse& response) final;
         void didReceiveResponse(const ResourceResponse& response) final;
-        void didReceiveData(const char* data, int length) final;
+        void didReceiveData(Vector<char>&& data) final;
         void didFinishLoading() final;
         void didFail(const ResourceError& error) final;
     private:
@@ -31,7 +31,11 @@
 #include "TextEncodingRegistry.h"
 #include "ThreadGlobalData.h"
 #include <array>
+#include "TextCodecASCIIFastPath.h"
 #include <unicode/ucnv_cb.h>
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/Threading.h>
 #include <wtf/text/CString.h>
 #include <wtf/text/StringBuilder.h>
@@ -41,6 +45,10 @@ namespace WebCore {
 
 const size_t ConversionBufferSize = 16384;
 
+// Marks bytes the single-byte table cannot decode on its own. A chunk
+// containing one goes through ICU so that its error handling applies.
+const UChar unmappedCharacter = 0xFFFF;
+
 #define DECLARE_ALIASES(encoding, ...) \
     static const char* const encoding##_aliases[] { __VA_ARGS__ }
 
@@ -250,6 +258,121 @@ int TextCodecICU::decodeToBuffer(UChar* target, UChar* targetLimit, const char*&
     return target - targetStart;
 }
 
+static std::unique_ptr<TextCodecICU::SingleByteTable> createSingleByteTable(const char* canonicalConverterName)
+{
+    UErrorCode error = U_ZERO_ERROR;
+    ICUConverterPtr converter { ucnv_open(canonicalConverterName, &error), ucnv_close };
+    if (!converter || U_FAILURE(error) || ucnv_getType(converter.get()) != UCNV_SBCS)
+        return nullptr;
+
+    ucnv_setFallback(converter.get(), TRUE);
+    ucnv_setToUCallBack(converter.get(), UCNV_TO_U_CALLBACK_STOP, nullptr, nullptr, nullptr, &error);
+    if (U_FAILURE(error))
+        return nullptr;
+
+    auto table = std::make_unique<TextCodecICU::SingleByteTable>();
+    table->isASCIICompatible = true;
+    for (unsigned byte = 0; byte < 256; ++byte) {
+        char input = static_cast<char>(byte);
+        const char* source = &input;
+        UChar output[2];
+        UChar* target = output;
+        error = U_ZERO_ERROR;
+        ucnv_toUnicode(converter.get(), &target, output + 2, &source, &input + 1, nullptr, true, &error);
+        if (U_FAILURE(error) || target - output != 1)
+            table->characters[byte] = unmappedCharacter;
+        else
+            table->characters[byte] = output[0];
+        if (isASCII(byte) && table->characters[byte] != byte)
+            table->isASCIICompatible = false;
+        ucnv_reset(converter.get());
+    }
+    return table;
+}
+
+const TextCodecICU::SingleByteTable* TextCodecICU::singleByteTable() const
+{
+    if (m_didLookUpSingleByteTable)
+        return m_singleByteTable;
+
+    // Tables are shared by all codecs for the same converter and live for the
+    // lifetime of the process, like the encoding registry itself.
+    static Lock lock;
+    static NeverDestroyed<HashMap<const char*, std::unique_ptr<SingleByteTable>>> tables;
+
+    std::lock_guard<Lock> locker(lock);
+    auto result = tables.get().add(m_canonicalConverterName, nullptr);
+    if (result.isNewEntry)
+        result.iterator->value = createSingleByteTable(m_canonicalConverterName);
+    m_singleByteTable = result.iterator->value.get();
+    m_didLookUpSingleByteTable = true;
+    return m_singleByteTable;
+}
+
+// Returns false if the bytes contain an unmapped byte, sets needs16Bit if any
+// of them decodes to a character beyond Latin-1.
+static bool scanSingleByte(const TextCodecICU::SingleByteTable& table, const uint8_t* source, const uint8_t* end, bool& needs16Bit)
+{
+    const uint8_t* alignedEnd = alignToMachineWord(end);
+    while (source < end) {
+        if (table.isASCIICompatible && isAlignedToMachineWord(source)) {
+            while (source < alignedEnd && isAllASCII<LChar>(*reinterpret_cast_ptr<const MachineWord*>(source)))
+                source += sizeof(MachineWord);
+            if (source == end)
+                break;
+        }
+        UChar character = table.characters[*source++];
+        if (character == unmappedCharacter)
+            return false;
+        if (character > 0xFF)
+            needs16Bit = true;
+    }
+    return true;
+}
+
+template<typename CharacterType>
+static void convertSingleByte(const TextCodecICU::SingleByteTable& table, const uint8_t* source, const uint8_t* end, CharacterType* destination)
+{
+    const uint8_t* alignedEnd = alignToMachineWord(end);
+    while (source < end) {
+        if (table.isASCIICompatible && isAlignedToMachineWord(source)) {
+            while (source < alignedEnd) {
+                MachineWord chunk = *reinterpret_cast_ptr<const MachineWord*>(source);
+                if (!isAllASCII<LChar>(chunk))
+                    break;
+                copyASCIIMachineWord(destination, source);
+                source += sizeof(MachineWord);
+                destination += sizeof(MachineWord);
+            }
+            if (source == end)
+                break;
+        }
+        *destination++ = static_cast<CharacterType>(table.characters[*source++]);
+    }
+}
+
+static String decodeSingleByte(const TextCodecICU::SingleByteTable& table, const char* bytes, size_t length)
+{
+    const uint8_t* source = reinterpret_cast<const uint8_t*>(bytes);
+    const uint8_t* end = source + length;
+
+    bool needs16Bit = false;
+    if (!scanSingleByte(table, source, end, needs16Bit))
+        return { };
+
+    if (!needs16Bit) {
+        LChar* characters;
+        String result = String::createUninitialized(length, characters);
+        convertSingleByte(table, source, end, characters);
+        return result;
+    }
+
+    UChar* characters;
+    String result = String::createUninitialized(length, characters);
+    convertSingleByte(table, source, end, characters);
+    return result;
+}
+
 class ErrorCallbackSetter {
 public:
     ErrorCallbackSetter(UConverter& converter, bool stopOnError)
@@ -294,6 +417,15 @@ String TextCodecICU::decode(const char* bytes, size_t length, bool flush, bool s
         }
     }
 
+    // Single-byte encodings are stateless, so a chunk can be decoded with a
+    // plain lookup table instead of going through the converter.
+    auto* table = singleByteTable();
+    if (table && length) {
+        String result = decodeSingleByte(*table, bytes, length);
+        if (!result.isNull())
+            return result;
+    }
+
     ErrorCallbackSetter callbackSetter(*m_converter, stopOnError);
 
     StringBuilder result;
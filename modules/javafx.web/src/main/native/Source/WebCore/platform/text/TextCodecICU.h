@@ -27,6 +27,7 @@
 #pragma once
 
 #include "TextCodec.h"
+#include <array>
 #include <unicode/ucnv.h>
 
 namespace WebCore {
@@ -41,6 +42,12 @@ public:
     static void registerEncodingNames(EncodingNameRegistrar);
     static void registerCodecs(TextCodecRegistrar);
 
+    // Byte to UTF-16 mapping of a stateless single-byte converter.
+    struct SingleByteTable {
+        std::array<UChar, 256> characters;
+        bool isASCIICompatible;
+    };
+
 private:
     String decode(const char*, size_t length, bool flush, bool stopOnError, bool& sawError) final;
     Vector<uint8_t> encode(StringView, UnencodableHandling) final;
@@ -51,11 +58,14 @@ private:
     void setNeedsGBKFallbacks(bool needsFallbacks) { m_needsGBKFallbacks = needsFallbacks; }
 
     int decodeToBuffer(UChar* buffer, UChar* bufferLimit, const char*& source, const char* sourceLimit, int32_t* offsets, bool flush, UErrorCode&);
+    const SingleByteTable* singleByteTable() const;
 
     const char* const m_encodingName;
     const char* const m_canonicalConverterName;
     mutable ICUConverterPtr m_converter { nullptr, ucnv_close };
     mutable bool m_needsGBKFallbacks { false };
+    mutable const SingleByteTable* m_singleByteTable { nullptr };
+    mutable bool m_didLookUpSingleByteTable { false };
 };
 
 struct ICUConverterWrapper {
@@ -178,6 +178,7 @@ RenderStyle::RenderStyle(CreateDefaultStyleTag)
     m_nonInheritedFlags.hasExplicitlySetTextAlign = false;
     m_nonInheritedFlags.hasViewportUnits = false;
     m_nonInheritedFlags.hasExplicitlyInheritedProperties = false;
+    m_nonInheritedFlags.usesCustomProperties = false;
     m_nonInheritedFlags.isUnique = false;
     m_nonInheritedFlags.emptyState = false;
     m_nonInheritedFlags.firstChildState = false;
@@ -431,6 +432,14 @@ bool RenderStyle::inheritedNotEqual(const RenderStyle* other) const
         || m_rareInheritedData != other->m_rareInheritedData;
 }
 
+bool RenderStyle::inheritedEqualIgnoringCustomProperties(const RenderStyle& other) const
+{
+    return m_inheritedFlags == other.m_inheritedFlags
+        && m_inheritedData == other.m_inheritedData
+        && !m_svgStyle->inheritedNotEqual(other.m_svgStyle)
+        && (m_rareInheritedData.ptr() == other.m_rareInheritedData.ptr() || m_rareInheritedData->equalIgnoringCustomProperties(*other.m_rareInheritedData));
+}
+
 #if ENABLE(TEXT_AUTOSIZING)
 
 static inline unsigned computeFontHash(const FontCascade& font)
@@ -185,6 +185,7 @@ public:
 
     const CustomPropertyValueMap& customProperties() const { return m_rareInheritedData->customProperties->values; }
     void setCustomPropertyValue(const AtomicString& name, Ref<CSSCustomPropertyValue>&& value) { return m_rareInheritedData.access().customProperties.access().setCustomPropertyValue(name, WTFMove(value)); }
+    void inheritCustomPropertiesFrom(const RenderStyle& inheritParent) { m_rareInheritedData.access().customProperties = inheritParent.m_rareInheritedData->customProperties; }
 
     void setHasViewportUnits(bool v = true) { m_nonInheritedFlags.hasViewportUnits = v; }
     bool hasViewportUnits() const { return m_nonInheritedFlags.hasViewportUnits; }
@@ -1377,6 +1378,7 @@ public:
     const AtomicString& hyphenString() const;
 
     bool inheritedNotEqual(const RenderStyle*) const;
+    bool inheritedEqualIgnoringCustomProperties(const RenderStyle&) const;
     bool inheritedDataShared(const RenderStyle*) const;
 
 #if ENABLE(TEXT_AUTOSIZING)
@@ -1421,6 +1423,9 @@ public:
     void setHasExplicitlyInheritedProperties() { m_nonInheritedFlags.hasExplicitlyInheritedProperties = true; }
     bool hasExplicitlyInheritedProperties() const { return m_nonInheritedFlags.hasExplicitlyInheritedProperties; }
 
+    void setUsesCustomProperties() { m_nonInheritedFlags.usesCustomProperties = true; }
+    bool usesCustomProperties() const { return m_nonInheritedFlags.usesCustomProperties; }
+
     // Initial values for all the properties
     static Overflow initialOverflowX() { return Overflow::Visible; }
     static Overflow initialOverflowY() { return Overflow::Visible; }
@@ -1760,6 +1765,7 @@ private:
         unsigned hasExplicitlySetTextAlign : 1;
         unsigned hasViewportUnits : 1;
         unsigned hasExplicitlyInheritedProperties : 1; // Explicitly inherits a non-inherited property.
+        unsigned usesCustomProperties : 1; // Declares a custom property or references one with var().
         unsigned isUnique : 1; // Style cannot be shared.
         unsigned emptyState : 1;
         unsigned firstChildState : 1;
@@ -1886,6 +1892,7 @@ inline bool RenderStyle::NonInheritedFlags::operator==(const NonInheritedFlags&
         && hasExplicitlySetTextAlign == other.hasExplicitlySetTextAlign
         && hasViewportUnits == other.hasViewportUnits
         && hasExplicitlyInheritedProperties == other.hasExplicitlyInheritedProperties
+        && usesCustomProperties == other.usesCustomProperties
         && isUnique == other.isUnique
         && emptyState == other.emptyState
         && firstChildState == other.firstChildState
@@ -1913,6 +1920,7 @@ inline void RenderStyle::NonInheritedFlags::copyNonInheritedFrom(const NonInheri
     tableLayout = other.tableLayout;
     hasViewportUnits = other.hasViewportUnits;
     hasExplicitlyInheritedProperties = other.hasExplicitlyInheritedProperties;
+    usesCustomProperties = other.usesCustomProperties;
 }
 
 inline bool RenderStyle::NonInheritedFlags::hasPseudoStyle(PseudoId pseudo) const
@@ -256,6 +256,11 @@ Ref<StyleRareInheritedData> StyleRareInheritedData::copy() const
 StyleRareInheritedData::~StyleRareInheritedData() = default;
 
 bool StyleRareInheritedData::operator==(const StyleRareInheritedData& o) const
+{
+    return equalIgnoringCustomProperties(o) && customProperties == o.customProperties;
+}
+
+bool StyleRareInheritedData::equalIgnoringCustomProperties(const StyleRareInheritedData& o) const
 {
     return textStrokeColor == o.textStrokeColor
         && textStrokeWidth == o.textStrokeWidth
@@ -345,7 +350,6 @@ bool StyleRareInheritedData::operator==(const StyleRareInheritedData& o) const
         && strokeColor == o.strokeColor
         && visitedLinkStrokeColor == o.visitedLinkStrokeColor
         && miterLimit == o.miterLimit
-        && customProperties == o.customProperties
         && arePointingToEqualData(listStyleImage, o.listStyleImage);
 }
 
@@ -53,6 +53,7 @@ public:
     ~StyleRareInheritedData();
 
     bool operator==(const StyleRareInheritedData& o) const;
+    bool equalIgnoringCustomProperties(const StyleRareInheritedData&) const;
     bool operator!=(const StyleRareInheritedData& o) const
     {
         return !(*this == o);
@@ -34,6 +34,7 @@
 #include "RenderStyle.h"
 #include "SVGElement.h"
 #include "ShadowRoot.h"
+#include "StyleProperties.h"
 #include "StyleScope.h"
 #include "StyleUpdate.h"
 #include "StyledElement.h"
@@ -71,6 +72,28 @@ static inline bool elementHasDirectionAuto(const Element& element)
     return is<HTMLElement>(element) && downcast<HTMLElement>(element).hasDirectionAuto();
 }
 
+// Elements generated from the same markup, such as the cells of a table or
+// grid, often carry identical inline styles and can then share style too.
+static bool inlineStylesAreEqual(const StyleProperties* inlineStyle, const StyleProperties* otherInlineStyle)
+{
+    if (inlineStyle == otherInlineStyle)
+        return true;
+    if (!inlineStyle || !otherInlineStyle)
+        return false;
+    unsigned propertyCount = inlineStyle->propertyCount();
+    if (propertyCount != otherInlineStyle->propertyCount())
+        return false;
+    for (unsigned i = 0; i < propertyCount; ++i) {
+        auto property = inlineStyle->propertyAt(i);
+        auto otherProperty = otherInlineStyle->propertyAt(i);
+        if (property.id() != otherProperty.id() || property.isImportant() != otherProperty.isImportant())
+            return false;
+        if (!property.value()->equals(*otherProperty.value()))
+            return false;
+    }
+    return true;
+}
+
 std::unique_ptr<RenderStyle> SharingResolver::resolve(const Element& searchElement, const Update& update)
 {
     if (!is<StyledElement>(searchElement))
@@ -83,9 +106,6 @@ std::unique_ptr<RenderStyle> SharingResolver::resolve(const Element& searchEleme
         return nullptr;
     if (!update.elementStyle(parentElement))
         return nullptr;
-    // If the element has inline style it is probably unique.
-    if (element.inlineStyle())
-        return nullptr;
     if (element.isSVGElement() && downcast<SVGElement>(element).animatedSMILStyleProperties())
         return nullptr;
     // Ids stop style sharing if they show up in the stylesheets.
@@ -208,7 +228,7 @@ bool SharingResolver::canShareStyleWithElement(const Context& context, const Sty
         return false;
     if (candidateElement.tagQName() != element.tagQName())
         return false;
-    if (candidateElement.inlineStyle())
+    if (!inlineStylesAreEqual(element.inlineStyle(), candidateElement.inlineStyle()))
         return false;
     if (candidateElement.needsStyleRecalc())
         return false;
@@ -115,6 +115,8 @@ void TreeResolver::popScope()
 
 std::unique_ptr<RenderStyle> TreeResolver::styleForElement(Element& element, const RenderStyle& inheritedStyle)
 {
+    element.resetStyleRelations();
+
     if (element.hasCustomStyleResolveCallbacks()) {
         RenderStyle* shadowHostStyle = scope().shadowRoot ? m_update->elementStyle(*scope().shadowRoot->host()) : nullptr;
         if (auto customStyle = element.resolveCustomStyle(inheritedStyle, shadowHostStyle)) {
@@ -191,6 +193,87 @@ static DescendantsToResolve computeDescendantsToResolve(Change change, Validity
     return DescendantsToResolve::None;
 };
 
+static bool onlyCustomPropertiesAffectChildren(const RenderStyle& oldStyle, const RenderStyle& newStyle)
+{
+    // These are not inherited but still affect children, see determineChange().
+    if (oldStyle.alignItems() != newStyle.alignItems() || oldStyle.justifyItems() != newStyle.justifyItems())
+        return false;
+    return oldStyle.inheritedEqualIgnoringCustomProperties(newStyle);
+}
+
+// A child that neither declares nor references custom properties would resolve to its existing style
+// with the parent's new custom property values. Reuse that style instead of matching and applying its rules.
+static std::unique_ptr<RenderStyle> styleWithChangedCustomProperties(const Element& element, const RenderStyle& parentStyle)
+{
+    if (element.styleValidity() != Validity::Valid)
+        return nullptr;
+    if (element.hasCustomStyleResolveCallbacks() || &element == element.document().documentElement())
+        return nullptr;
+    auto* existingStyle = element.renderStyle();
+    if (!existingStyle)
+        return nullptr;
+    if (existingStyle->usesCustomProperties() || existingStyle->hasExplicitlyInheritedProperties())
+        return nullptr;
+    if (existingStyle->hasAnyPublicPseudoStyles() || existingStyle->hasAnimationsOrTransitions())
+        return nullptr;
+
+    auto style = RenderStyle::clonePtr(*existingStyle);
+    style->inheritCustomPropertiesFrom(parentStyle);
+    return style;
+}
+
+// Relations in element rare data that matching descendants may record on an element, e.g. AffectedByActive
+// for '.box:active .label' on the .box. Resolving the element resets them, and descendants that reuse their
+// style through styleWithChangedCustomProperties() don't record them again.
+struct DescendantRelations {
+    bool styleAffectedByActive { false };
+    bool styleAffectedByEmpty { false };
+    bool styleAffectedByFocusWithin { false };
+    bool childrenAffectedByDrag { false };
+    bool childrenAffectedByForwardPositionalRules { false };
+    bool descendantsAffectedByForwardPositionalRules { false };
+    bool childrenAffectedByBackwardPositionalRules { false };
+    bool descendantsAffectedByBackwardPositionalRules { false };
+    bool childrenAffectedByPropertyBasedBackwardPositionalRules { false };
+};
+
+static DescendantRelations descendantRelations(const Element& element)
+{
+    DescendantRelations relations;
+    relations.styleAffectedByActive = element.styleAffectedByActive();
+    relations.styleAffectedByEmpty = element.styleAffectedByEmpty();
+    relations.styleAffectedByFocusWithin = element.styleAffectedByFocusWithin();
+    relations.childrenAffectedByDrag = element.childrenAffectedByDrag();
+    relations.childrenAffectedByForwardPositionalRules = element.childrenAffectedByForwardPositionalRules();
+    relations.descendantsAffectedByForwardPositionalRules = element.descendantsAffectedByForwardPositionalRules();
+    relations.childrenAffectedByBackwardPositionalRules = element.childrenAffectedByBackwardPositionalRules();
+    relations.descendantsAffectedByBackwardPositionalRules = element.descendantsAffectedByBackwardPositionalRules();
+    relations.childrenAffectedByPropertyBasedBackwardPositionalRules = element.childrenAffectedByPropertyBasedBackwardPositionalRules();
+    return relations;
+}
+
+static void restoreDescendantRelations(Element& element, const DescendantRelations& relations)
+{
+    if (relations.styleAffectedByActive)
+        element.setStyleAffectedByActive();
+    if (relations.styleAffectedByEmpty)
+        element.setStyleAffectedByEmpty();
+    if (relations.styleAffectedByFocusWithin)
+        element.setStyleAffectedByFocusWithin();
+    if (relations.childrenAffectedByDrag)
+        element.setChildrenAffectedByDrag();
+    if (relations.childrenAffectedByForwardPositionalRules)
+        element.setChildrenAffectedByForwardPositionalRules();
+    if (relations.descendantsAffectedByForwardPositionalRules)
+        element.setDescendantsAffectedByForwardPositionalRules();
+    if (relations.childrenAffectedByBackwardPositionalRules)
+        element.setChildrenAffectedByBackwardPositionalRules();
+    if (relations.descendantsAffectedByBackwardPositionalRules)
+        element.setDescendantsAffectedByBackwardPositionalRules();
+    if (relations.childrenAffectedByPropertyBasedBackwardPositionalRules)
+        element.setChildrenAffectedByPropertyBasedBackwardPositionalRules();
+}
+
 ElementUpdates TreeResolver::resolveElement(Element& element)
 {
     if (m_didSeePendingStylesheet && !element.renderer() && !m_document.isIgnoringPendingStylesheets()) {
@@ -198,7 +281,14 @@ ElementUpdates TreeResolver::resolveElement(Element& element)
         return { };
     }
 
-    auto newStyle = styleForElement(element, parent().style);
+    std::unique_ptr<RenderStyle> newStyle;
+    if (parent().descendantsToResolve == DescendantsToResolve::ChildrenWithChangedCustomProperties)
+        newStyle = styleWithChangedCustomProperties(element, parent().style);
+    std::optional<DescendantRelations> relationsBeforeReset;
+    if (!newStyle) {
+        relationsBeforeReset = descendantRelations(element);
+        newStyle = styleForElement(element, parent().style);
+    }
 
     if (!affectsRenderedSubtree(element, *newStyle))
         return { };
@@ -212,6 +302,15 @@ ElementUpdates TreeResolver::resolveElement(Element& element)
 
     auto update = createAnimatedElementUpdate(WTFMove(newStyle), element, parent().change);
     auto descendantsToResolve = computeDescendantsToResolve(update.change, element.styleValidity(), parent().descendantsToResolve);
+    if (descendantsToResolve == DescendantsToResolve::Children && existingStyle && onlyCustomPropertiesAffectChildren(*existingStyle, *update.style))
+        descendantsToResolve = DescendantsToResolve::ChildrenWithChangedCustomProperties;
+
+    // Changed custom properties let descendants reuse their style, possibly below fully resolved children.
+    // Keep the relations they recorded on this element when they were matched.
+    bool descendantsMayReuseStyle = descendantsToResolve == DescendantsToResolve::ChildrenWithChangedCustomProperties
+        || (descendantsToResolve == DescendantsToResolve::Children && existingStyle && existingStyle->customProperties() != update.style->customProperties());
+    if (relationsBeforeReset && descendantsMayReuseStyle)
+        restoreDescendantRelations(element, *relationsBeforeReset);
 
     if (&element == m_document.documentElement()) {
         m_documentElementStyle = RenderStyle::clonePtr(*update.style);
@@ -393,6 +492,7 @@ static bool shouldResolveElement(const Element& element, DescendantsToResolve pa
     switch (parentDescendantsToResolve) {
     case DescendantsToResolve::None:
         return false;
+    case DescendantsToResolve::ChildrenWithChangedCustomProperties:
     case DescendantsToResolve::Children:
     case DescendantsToResolve::All:
         return true;
@@ -490,7 +590,6 @@ void TreeResolver::resolveComposedTree()
         if (shouldResolve) {
             if (!element.hasDisplayContents())
                 element.resetComputedStyle();
-            element.resetStyleRelations();
 
             if (element.hasCustomStyleResolveCallbacks())
                 element.willRecalcStyle(parent.change);
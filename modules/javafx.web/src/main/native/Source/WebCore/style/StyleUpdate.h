@@ -48,7 +48,7 @@ struct ElementUpdate {
     bool recompositeLayer { false };
 };
 
-enum class DescendantsToResolve { None, ChildrenWithExplicitInherit, Children, All };
+enum class DescendantsToResolve { None, ChildrenWithExplicitInherit, ChildrenWithChangedCustomProperties, Children, All };
 
 struct ElementUpdates {
     ElementUpdate update;
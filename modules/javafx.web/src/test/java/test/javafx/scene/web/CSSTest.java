@@ -284,4 +284,94 @@ public class CSSTest extends TestBase {
         load(new File(FILE));
         assertEquals("Loading Long SelectorList completed successfully", SUCCEEDED, getLoadState());
     }
+
+    @Test public void testStyleSharingWithInlineStyles() {
+        loadContent(
+                "<p><span id='a' style='color: rgb(0, 0, 255)'>a</span>"
+                + "<span id='b' style='color: rgb(0, 0, 255)'>b</span>"
+                + "<span id='c' style='color: rgb(255, 0, 0)'>c</span>"
+                + "<span id='d' style='color: rgb(255, 0, 0) !important'>d</span>"
+                + "<span id='e'>e</span></p>");
+        submit(() -> {
+            String[] ids = { "a", "b", "c", "d", "e" };
+            String[] colors = { "rgb(0, 0, 255)", "rgb(0, 0, 255)", "rgb(255, 0, 0)",
+                    "rgb(255, 0, 0)", "rgb(0, 0, 0)" };
+            for (int i = 0; i < ids.length; i++) {
+                assertEquals("Color of #" + ids[i], colors[i],
+                        getEngine().executeScript(
+                                "getComputedStyle(document.getElementById('" + ids[i] + "')).color"));
+            }
+            // Changing the inline style of a sibling that shared its style
+            // must not affect the other one.
+            getEngine().executeScript(
+                    "document.getElementById('b').style.color = 'rgb(0, 128, 0)'");
+            assertEquals("Color of #a", "rgb(0, 0, 255)",
+                    getEngine().executeScript(
+                            "getComputedStyle(document.getElementById('a')).color"));
+            assertEquals("Color of #b", "rgb(0, 128, 0)",
+                    getEngine().executeScript(
+                            "getComputedStyle(document.getElementById('b')).color"));
+        });
+    }
+
+    @Test public void testCustomPropertyChangeOnRoot() {
+        loadContent(
+                "<style>:root { --accent: red; } .accent { color: var(--accent); }</style>"
+                + "<div><p><span id='themed' class='accent'>themed</span>"
+                + "<span id='plain'>plain</span></p></div>");
+        submit(() -> {
+            getEngine().executeScript(
+                    "document.documentElement.style.setProperty('--accent', 'rgb(0, 128, 0)')");
+            assertEquals("Element referencing the custom property", "rgb(0, 128, 0)",
+                    getEngine().executeScript(
+                            "getComputedStyle(document.getElementById('themed')).color"));
+            assertEquals("Element inheriting the custom property", "rgb(0, 128, 0)",
+                    getEngine().executeScript(
+                            "getComputedStyle(document.getElementById('plain')).getPropertyValue('--accent').trim()"));
+        });
+    }
+
+    @Test public void testPositionalRulesAfterCustomPropertyChange() {
+        loadContent(
+                "<style>li:last-child { color: rgb(255, 0, 0); }"
+                + " li:nth-last-child(2) { color: rgb(0, 0, 255); }</style>"
+                + "<ul id='list' style='--accent: red'><li id='first'>first</li>"
+                + "<li id='second'>second</li></ul>");
+        submit(() -> {
+            getEngine().executeScript(
+                    "document.getElementById('list').style.setProperty('--accent', 'green')");
+            // Resolve the style while the list items can reuse theirs.
+            assertEquals("rgb(255, 0, 0)", getEngine().executeScript(
+                    "getComputedStyle(document.getElementById('second')).color"));
+            getEngine().executeScript(
+                    "var item = document.createElement('li');"
+                    + "item.id = 'third';"
+                    + "document.getElementById('list').appendChild(item)");
+            assertEquals("Former first child", "rgb(0, 0, 0)", getEngine().executeScript(
+                    "getComputedStyle(document.getElementById('first')).color"));
+            assertEquals("Former last child", "rgb(0, 0, 255)", getEngine().executeScript(
+                    "getComputedStyle(document.getElementById('second')).color"));
+            assertEquals("Appended last child", "rgb(255, 0, 0)", getEngine().executeScript(
+                    "getComputedStyle(document.getElementById('third')).color"));
+        });
+    }
+
+    @Test public void testAncestorFocusWithinAfterCustomPropertyChange() {
+        loadContent(
+                "<style>.box { background-color: var(--accent); }"
+                + " .box:focus-within .label { color: rgb(255, 0, 0); }</style>"
+                + "<div class='box' id='box' style='--accent: white'>"
+                + "<span class='label' id='label'>label</span><input id='input'></div>");
+        submit(() -> {
+            getEngine().executeScript(
+                    "document.getElementById('box').style.setProperty('--accent', 'yellow')");
+            // Resolve the style while the label can reuse its own.
+            assertEquals("rgb(0, 0, 0)", getEngine().executeScript(
+                    "getComputedStyle(document.getElementById('label')).color"));
+            getEngine().executeScript("document.getElementById('input').focus()");
+            assertEquals("Label in a box with focus within", "rgb(255, 0, 0)",
+                    getEngine().executeScript(
+                            "getComputedStyle(document.getElementById('label')).color"));
+        });
+    }
 }
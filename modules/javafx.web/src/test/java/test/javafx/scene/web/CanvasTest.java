@@ -125,6 +125,66 @@ public class CanvasTest extends TestBase {
         });
     }
 
+    @Test public void testCanvasIsPointInPath() {
+        final String htmlCanvasPath =
+                "<canvas id='canvas' width='200' height='200'></canvas> <script>" +
+                        "var context = document.getElementById('canvas').getContext('2d');" +
+                        "context.beginPath();" +
+                        "context.moveTo(0, 0); context.lineTo(100, 0);" +
+                        "context.lineTo(100, 100); context.lineTo(0, 100);" +
+                        "context.closePath();" +
+                        "context.moveTo(25, 25); context.lineTo(75, 25);" +
+                        "context.lineTo(75, 75); context.lineTo(25, 75);" +
+                        "context.closePath();" +
+                        "</script>";
+
+        loadContent(htmlCanvasPath);
+        submit(() -> {
+            final String ctx = "document.getElementById('canvas').getContext('2d')";
+            assertTrue("Point inside both subpaths with nonzero rule",
+                    (Boolean) getEngine().executeScript(ctx + ".isPointInPath(50, 50, 'nonzero')"));
+            assertFalse("Point inside both subpaths with evenodd rule",
+                    (Boolean) getEngine().executeScript(ctx + ".isPointInPath(50, 50, 'evenodd')"));
+            assertTrue("Point inside the outer subpath only",
+                    (Boolean) getEngine().executeScript(ctx + ".isPointInPath(10, 10, 'evenodd')"));
+            assertFalse("Point outside the path",
+                    (Boolean) getEngine().executeScript(ctx + ".isPointInPath(150, 150)"));
+
+            // A curve makes the query to be computed by the Java path
+            getEngine().executeScript(ctx + ".moveTo(150, 0)");
+            getEngine().executeScript(ctx + ".bezierCurveTo(160, 0, 170, 10, 170, 20)");
+            assertTrue("Point inside both subpaths with nonzero rule, curved path",
+                    (Boolean) getEngine().executeScript(ctx + ".isPointInPath(50, 50, 'nonzero')"));
+            assertFalse("Point inside both subpaths with evenodd rule, curved path",
+                    (Boolean) getEngine().executeScript(ctx + ".isPointInPath(50, 50, 'evenodd')"));
+        });
+    }
+
+    @Test public void testCanvasPathAddedToItself() {
+        loadContent("<canvas id='canvas' width='300' height='100'></canvas>");
+        submit(() -> {
+            final String ctx = "document.getElementById('canvas').getContext('2d')";
+            // Line segments only
+            getEngine().executeScript(
+                    "var lines = new Path2D(); lines.rect(0, 0, 50, 50);"
+                    + "lines.addPath(lines, {e: 100});");
+            assertTrue("Point inside the original rectangle",
+                    (Boolean) getEngine().executeScript(ctx + ".isPointInPath(lines, 25, 25)"));
+            assertTrue("Point inside the appended rectangle",
+                    (Boolean) getEngine().executeScript(ctx + ".isPointInPath(lines, 125, 25)"));
+            assertFalse("Point outside both rectangles",
+                    (Boolean) getEngine().executeScript(ctx + ".isPointInPath(lines, 75, 25)"));
+
+            // A curve keeps the segments in the Java path
+            getEngine().executeScript(
+                    "var curves = new Path2D(); curves.moveTo(0, 0);"
+                    + "curves.bezierCurveTo(50, 0, 50, 50, 0, 50); curves.closePath();"
+                    + "curves.addPath(curves);");
+            assertTrue("Point inside the curved path",
+                    (Boolean) getEngine().executeScript(ctx + ".isPointInPath(curves, 10, 25)"));
+        });
+    }
+
     private BufferedImage htmlCanvasToBufferedImage(final String mime) throws Exception {
         ByteArrayOutputStream errStream = new ByteArrayOutputStream();
         System.setErr(new PrintStream(errStream));
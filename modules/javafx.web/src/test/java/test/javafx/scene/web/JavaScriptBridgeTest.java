@@ -25,6 +25,11 @@
 
 package test.javafx.scene.web;
 
+import com.sun.webkit.WebPage;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+import java.util.Date;
 import javafx.scene.web.WebEngine;
 import netscape.javascript.JSException;
 import netscape.javascript.JSObject;
@@ -665,6 +670,96 @@ public class JavaScriptBridgeTest extends TestBase {
          });
     }
 
+    public static class FloatSummer {
+        public double sum(float[] values) {
+            double sum = 0;
+            for (float v : values) {
+                sum += v;
+            }
+            return sum;
+        }
+    }
+
+    public @Test void testBridgeTypedArrays() throws InterruptedException {
+        final WebEngine web = getEngine();
+
+        submit(() -> {
+            bind("summer", new FloatSummer());
+            assertEquals(Double.valueOf(6.5),
+                    web.executeScript("summer.sum(new Float32Array([1, 2, 3.5]))"));
+
+            // Direct buffers are bridged as Java objects by default.
+            FloatBuffer floats = ByteBuffer.allocateDirect(4 * Float.BYTES)
+                    .order(ByteOrder.nativeOrder()).asFloatBuffer();
+            floats.put(1, 2.5f);
+            bind("floats", floats);
+            assertEquals(Integer.valueOf(4), web.executeScript("floats.capacity()"));
+            assertSame(floats, web.executeScript("floats"));
+
+            WebPage.setShareDirectBuffers(true);
+            try {
+                bind("floats", floats);
+                assertEquals(Boolean.TRUE, web.executeScript("floats instanceof Float32Array"));
+                assertEquals(Integer.valueOf(4), web.executeScript("floats.length"));
+                assertEquals(Double.valueOf(2.5), web.executeScript("floats[1]"));
+                // The typed array shares memory with the direct buffer.
+                web.executeScript("floats[2] = 7");
+                assertEquals(7f, floats.get(2), 0f);
+
+                ByteBuffer bytes = ByteBuffer.allocateDirect(8);
+                bind("bytes", bytes);
+                assertEquals(Boolean.TRUE, web.executeScript("bytes instanceof ArrayBuffer"));
+                assertEquals(Integer.valueOf(8), web.executeScript("bytes.byteLength"));
+
+                // Read-only buffers are still bridged as Java objects.
+                ByteBuffer readOnly = bytes.asReadOnlyBuffer();
+                bind("readOnly", readOnly);
+                assertEquals(Boolean.TRUE, web.executeScript("readOnly.isReadOnly()"));
+                assertSame(readOnly, web.executeScript("readOnly"));
+            } finally {
+                WebPage.setShareDirectBuffers(false);
+            }
+
+            // Heap buffers are still bridged as Java objects.
+            bind("heap", ByteBuffer.allocate(8));
+            assertEquals(Integer.valueOf(8), web.executeScript("heap.capacity()"));
+        });
+    }
+
+    public static class DateHolder {
+        public Date date;
+
+        public void setDate(Date date) {
+            this.date = date;
+        }
+
+        public String getName() {
+            return "holder";
+        }
+    }
+
+    public @Test void testBridgeArgumentOfWrongClass() throws InterruptedException {
+        final WebEngine web = getEngine();
+
+        submit(() -> {
+            DateHolder holder = new DateHolder();
+            bind("holder", holder);
+            for (String call : new String[] {
+                    "holder.setDate(holder.getName())",
+                    "holder.setDate(undefined)",
+                    "holder.setDate(holder)" }) {
+                try {
+                    web.executeScript(call);
+                    fail("JSException expected for " + call);
+                } catch (JSException expected) {
+                }
+                assertNull(holder.date);
+            }
+            web.executeScript("holder.setDate(null)");
+            assertNull(holder.date);
+        });
+    }
+
     public @Test void testBridgeBadOverloading() throws InterruptedException {
         final WebEngine web = getEngine();
 
@@ -57,6 +57,7 @@ import static org.junit.Assert.assertNull;
 import static org.junit.Assert.assertTrue;
 import static org.junit.Assert.fail;
 
+import com.sun.javafx.PlatformUtil;
 import javafx.scene.web.WebEngineShim;
 import com.sun.webkit.WebPage;
 import com.sun.webkit.WebPageShim;
@@ -539,4 +540,17 @@ public class MiscellaneousTest extends TestBase {
             assertNull(getEngine().executeScript("window.xmlDoc.body"));
         });
     }
+
+    // WebAssembly is only built for x86-64 Linux, and needs the JIT.
+    @Test public void testWebAssemblyFollowsUseJIT() {
+        final boolean useJIT = Boolean.valueOf(System.getProperty(
+                "com.sun.webkit.useJIT", "true"));
+        final boolean built = PlatformUtil.isLinux()
+                && "amd64".equals(System.getProperty("os.arch"));
+        loadContent("<html></html>");
+        submit(() -> {
+            assertEquals(useJIT && built ? "object" : "undefined",
+                    getEngine().executeScript("typeof WebAssembly"));
+        });
+    }
 }
@@ -27,11 +27,14 @@ package test.javafx.scene.web;
 
 import com.sun.webkit.WebPage;
 import com.sun.webkit.WebPageShim;
+import java.io.File;
 import java.util.concurrent.Callable;
 import javafx.scene.web.WebEngineShim;
 
 import static org.junit.Assert.assertEquals;
 import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
 import org.junit.Test;
 
 public class WebPageTest extends TestBase {
@@ -90,6 +93,84 @@ public class WebPageTest extends TestBase {
                 "test/html/icutagparse.html").toExternalForm());
     }
 
+    @Test public void testSamplingProfiler() {
+        loadContent(HTML);
+        submit(() -> {
+            WebPage.startSamplingProfiler(100);
+            getEngine().executeScript(
+                    "function busyLoop() {"
+                    + "  var end = Date.now() + 200, n = 0;"
+                    + "  while (Date.now() < end) n++;"
+                    + "  return n;"
+                    + "}"
+                    + "busyLoop();");
+            String stacks = WebPage.stopSamplingProfiler();
+            // null where the sampling profiler is not built
+            if (stacks != null) {
+                assertTrue("Expected busyLoop in sampled stacks : " + stacks,
+                        stacks.contains("busyLoop"));
+            }
+        });
+    }
+
+    @Test(expected = IllegalStateException.class)
+    public void testStartSamplingProfilerFromNonEventThread() {
+        WebPage.startSamplingProfiler(0);
+    }
+
+    @Test public void testMemoryCacheStatistics() {
+        final String styles = new File("src/test/resources/test/html/imported-styles.css")
+                .toURI().toASCIIString();
+        final String page = "<html><head><link rel='stylesheet' href='" + styles
+                + "'></head><body><p class='head2'>Test</p></body></html>";
+
+        long[] initial = submit(() -> WebPage.getMemoryCacheStatistics());
+        assertEquals("Expected six counters : ", 6, initial.length);
+        for (long value : initial) {
+            assertTrue("Expected non-negative counter : " + value, value >= 0);
+        }
+
+        // Other tests may have loaded the style sheet already.
+        loadContent(page);
+        long[] first = submit(() -> WebPage.getMemoryCacheStatistics());
+        assertTrue("Expected the style sheet request to be counted",
+                first[0] + first[1] + first[2] > initial[0] + initial[1] + initial[2]);
+
+        // The style sheet is in the cache now.
+        loadContent(page);
+        long[] second = submit(() -> WebPage.getMemoryCacheStatistics());
+        assertTrue("Expected a hit or revalidation : " + first[0] + " -> " + second[0],
+                second[0] + second[1] > first[0] + first[1]);
+
+        submit(() -> {
+            // Nothing uses the style sheet anymore, so the smallest capacities evict it.
+            getEngine().executeScript(
+                    "document.querySelector('link').href = 'data:text/css,'");
+            long[] before = WebPage.getMemoryCacheStatistics();
+            try {
+                WebPage.setMemoryCacheCapacities(0, 0, 0);
+                long[] after = WebPage.getMemoryCacheStatistics();
+                assertTrue("Expected pruning to evict resources : " + before[3] + " -> " + after[3],
+                        after[3] > before[3]);
+                assertTrue("Expected the cache to shrink : " + before[5] + " -> " + after[5],
+                        after[5] < before[5]);
+            } finally {
+                // The defaults of the memory cache
+                WebPage.setMemoryCacheCapacities(0, 8192 * 1024, 8192 * 1024);
+            }
+        });
+    }
+
+    @Test public void testSetInvalidMemoryCacheCapacities() {
+        submit(() -> {
+            try {
+                WebPage.setMemoryCacheCapacities(2, 1, 4);
+                fail("IllegalArgumentException expected");
+            } catch (IllegalArgumentException expected) {
+            }
+        });
+    }
+
     @Test(expected = IllegalStateException.class)
     public void testGetClientTextLocationFromNonEventThread() {
         WebPage page = WebEngineShim.getPage(getEngine());